@@ -0,0 +1,242 @@
+/*
+============================================
+- File: ultabench.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Runner of registered
+  benchmarks and their report.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	struct Entry_t
+	{
+		std::string strName;
+		ULTBench::Benchmark_t fn;
+	};
+
+	std::vector<Entry_t>& GetBenchmarks()
+	{
+		static std::vector<Entry_t> g_Benchmarks;
+		return g_Benchmarks;
+	}
+
+	enum class Format_t : int
+	{
+		FORMAT_TEXT,
+		FORMAT_CSV,
+		FORMAT_JSON,
+	};
+
+	struct Options_t
+	{
+		std::string strFilter;
+		Format_t format = Format_t::FORMAT_TEXT;
+		double dMinTime = 0.2; // Seconds
+		bool bList = false;
+	};
+
+	struct Result_t
+	{
+		std::string strName;
+		size_t ziIterations;
+		double dNsPerOp;
+		double dAllocsPerOp;
+		double dAllocBytesPerOp;
+		double dNsPerItem; // 0 if benchmark has no items
+		double dMBPerSecond; // 0 if benchmark has no bytes
+		std::vector<std::pair<std::string, double>> vCounters;
+	};
+
+	// Runs benchmark with growing iteration count until it takes at least min time
+	Result_t Run(const Entry_t& entry, double minTime)
+	{
+		const double minNs = minTime * 1e9;
+		size_t iterations = 1;
+		for (;;)
+		{
+			ULTBench::State_t state(iterations);
+			entry.fn(state);
+
+			const double ns = (double)state.GetNanoseconds();
+			if (ns >= minNs || iterations >= ((size_t)1 << 40))
+			{
+				Result_t res;
+				res.strName = entry.strName;
+				res.ziIterations = iterations;
+				res.dNsPerOp = ns / iterations;
+				res.dAllocsPerOp = (double)state.GetAllocs().ziAllocs / iterations;
+				res.dAllocBytesPerOp = (double)state.GetAllocs().ziBytes / iterations;
+				res.dNsPerItem = state.GetItemsPerIteration() ? res.dNsPerOp / state.GetItemsPerIteration() : 0;
+				res.dMBPerSecond = state.GetBytesPerIteration() && ns > 0
+									   ? (double)state.GetBytesPerIteration() * iterations / (ns / 1e9) / 1e6
+									   : 0;
+				res.vCounters = state.GetCounters();
+				return res;
+			}
+
+			// Aim a bit past min time, but never grow more than 100x from a too short run
+			const double predicted = ns > 0 ? minNs * 1.2 / (ns / iterations) : (double)iterations * 100;
+			iterations = (size_t)std::max((double)iterations * 2, std::min((double)iterations * 100, predicted));
+		}
+	}
+
+	std::string EscapeJson(const std::string& str)
+	{
+		std::string res;
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\') res += '\\';
+			res += c;
+		}
+		return res;
+	}
+
+	void PrintHeader(Format_t format)
+	{
+		switch (format)
+		{
+		case Format_t::FORMAT_TEXT:
+			printf("%-56s %12s %14s %10s %12s  %s\n", "benchmark", "iterations", "ns/op", "allocs/op", "alloc B/op",
+				   "extra");
+			break;
+		case Format_t::FORMAT_CSV:
+			printf("name,iterations,ns_per_op,allocs_per_op,alloc_bytes_per_op,ns_per_item,mb_per_s,counters\n");
+			break;
+		case Format_t::FORMAT_JSON:
+			printf("{\n  \"benchmarks\": [");
+			break;
+		}
+	}
+
+	void PrintResult(Format_t format, const Result_t& res, bool first)
+	{
+		switch (format)
+		{
+		case Format_t::FORMAT_TEXT:
+		{
+			printf("%-56s %12zu %14.2f %10.3f %12.1f ", res.strName.c_str(), res.ziIterations, res.dNsPerOp,
+				   res.dAllocsPerOp, res.dAllocBytesPerOp);
+			if (res.dNsPerItem > 0) printf(" ns/item=%.3f", res.dNsPerItem);
+			if (res.dMBPerSecond > 0) printf(" MB/s=%.1f", res.dMBPerSecond);
+			for (const std::pair<std::string, double>& counter : res.vCounters)
+				printf(" %s=%g", counter.first.c_str(), counter.second);
+			printf("\n");
+			break;
+		}
+		case Format_t::FORMAT_CSV:
+		{
+			printf("%s,%zu,%.3f,%.4f,%.2f,%.4f,%.2f,", res.strName.c_str(), res.ziIterations, res.dNsPerOp,
+				   res.dAllocsPerOp, res.dAllocBytesPerOp, res.dNsPerItem, res.dMBPerSecond);
+			for (size_t i = 0; i < res.vCounters.size(); i++)
+				printf("%s%s=%g", i ? ";" : "", res.vCounters[i].first.c_str(), res.vCounters[i].second);
+			printf("\n");
+			break;
+		}
+		case Format_t::FORMAT_JSON:
+		{
+			printf("%s\n    {\"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f, "
+				   "\"alloc_bytes_per_op\": %.2f, \"ns_per_item\": %.4f, \"mb_per_s\": %.2f, \"counters\": {",
+				   first ? "" : ",", EscapeJson(res.strName).c_str(), res.ziIterations, res.dNsPerOp,
+				   res.dAllocsPerOp, res.dAllocBytesPerOp, res.dNsPerItem, res.dMBPerSecond);
+			for (size_t i = 0; i < res.vCounters.size(); i++)
+				printf("%s\"%s\": %g", i ? ", " : "", EscapeJson(res.vCounters[i].first).c_str(),
+					   res.vCounters[i].second);
+			printf("}}");
+			break;
+		}
+		}
+		fflush(stdout);
+	}
+
+	void PrintFooter(Format_t format)
+	{
+		if (format == Format_t::FORMAT_JSON) printf("\n  ]\n}\n");
+	}
+
+	bool StartsWith(const char* str, const char* prefix, const char*& rest)
+	{
+		const size_t length = strlen(prefix);
+		if (strncmp(str, prefix, length)) return false;
+		rest = str + length;
+		return true;
+	}
+
+	bool ParseOptions(int argc, char** argv, Options_t& options)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const char* value;
+			if (StartsWith(argv[i], "--filter=", value))
+				options.strFilter = value;
+			else if (StartsWith(argv[i], "--min-time=", value))
+				options.dMinTime = atof(value);
+			else if (StartsWith(argv[i], "--format=", value))
+			{
+				if (!strcmp(value, "text"))
+					options.format = Format_t::FORMAT_TEXT;
+				else if (!strcmp(value, "csv"))
+					options.format = Format_t::FORMAT_CSV;
+				else if (!strcmp(value, "json"))
+					options.format = Format_t::FORMAT_JSON;
+				else
+					return false;
+			}
+			else if (!strcmp(argv[i], "--list"))
+				options.bList = true;
+			else
+				return false;
+		}
+		return true;
+	}
+} // namespace
+
+bool ULTBench::Register(std::string name, Benchmark_t fn)
+{
+	GetBenchmarks().push_back(Entry_t{std::move(name), std::move(fn)});
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	Options_t options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		fprintf(stderr,
+				"usage: %s [--filter=<substring>] [--format=text|csv|json] [--min-time=<seconds>] [--list]\n",
+				argv[0]);
+		return 2;
+	}
+
+	std::vector<Entry_t>& benchmarks = GetBenchmarks();
+	std::stable_sort(benchmarks.begin(), benchmarks.end(),
+					 [](const Entry_t& a, const Entry_t& b) { return a.strName < b.strName; });
+
+	if (options.bList)
+	{
+		for (const Entry_t& entry : benchmarks)
+			if (entry.strName.find(options.strFilter) != std::string::npos) printf("%s\n", entry.strName.c_str());
+		return 0;
+	}
+
+	PrintHeader(options.format);
+	bool first = true;
+	for (const Entry_t& entry : benchmarks)
+	{
+		if (entry.strName.find(options.strFilter) == std::string::npos) continue;
+		PrintResult(options.format, Run(entry, options.dMinTime), first);
+		first = false;
+	}
+	PrintFooter(options.format);
+	return 0;
+}
@@ -0,0 +1,209 @@
+/*
+============================================
+- File: ultabench.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Tiny benchmark harness
+  measuring ns/op and allocations/op.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTABENCH_HPP
+#define ULTABENCH_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define __ULTBENCH_UNUSED __attribute__((unused))
+#else
+#define __ULTBENCH_UNUSED
+#endif
+
+namespace ULTBench
+{
+	// Counted by global operator new/delete of ultabench_alloc.cpp, on every thread
+	struct AllocStats_t
+	{
+		uint64_t ziAllocs;
+		uint64_t ziBytes;
+	};
+
+	AllocStats_t GetAllocStats() noexcept;
+
+	class State_t;
+	using Benchmark_t = std::function<void(State_t&)>;
+
+	// Returns true so it can initialize a static, see ULTBENCH
+	bool Register(std::string name, Benchmark_t fn);
+
+	// Passed to benchmark, which runs its body once per iteration:
+	//		for (auto _ : state) { ... }
+	// Time and allocations are measured only inside the loop, setup before it isn't counted.
+	class State_t final
+	{
+	public:
+		using Clock_t = std::chrono::steady_clock;
+
+		struct Sentinel_t
+		{
+		};
+
+		// Type of loop variable, marked so unused "_" isn't warned about
+		struct __ULTBENCH_UNUSED Value_t
+		{
+		};
+
+		class Iterator_t final
+		{
+		public:
+			inline explicit Iterator_t(State_t* state) noexcept : m_pState(state), m_ziLeft(state->m_ziIterations) {}
+
+			inline Value_t operator*() const noexcept { return Value_t(); }
+			inline Iterator_t& operator++() noexcept
+			{
+				m_ziLeft--;
+				return *this;
+			}
+			inline bool operator!=(const Sentinel_t&) noexcept
+			{
+				if (m_ziLeft) return true;
+				m_pState->Stop();
+				return false;
+			}
+
+		private:
+			State_t* m_pState;
+			size_t m_ziLeft;
+		};
+
+		inline explicit State_t(size_t iterations) noexcept
+			: m_ziIterations(iterations), m_ziItems(0), m_ziBytes(0), m_bRunning(false), m_bPaused(false),
+			  m_llNanoseconds(0), m_Allocs{0, 0}
+		{
+		}
+
+		inline Iterator_t begin() noexcept
+		{
+			Start();
+			return Iterator_t(this);
+		}
+		inline Sentinel_t end() const noexcept { return Sentinel_t(); }
+
+		inline size_t GetIterations() const noexcept { return m_ziIterations; }
+
+		// Excludes part of the loop body (e.g. rebuilding input) from time and allocations
+		inline void PauseTiming() noexcept
+		{
+			Accumulate();
+			m_bPaused = true;
+		}
+		inline void ResumeTiming() noexcept
+		{
+			m_bPaused = false;
+			Mark();
+		}
+
+		// Work done by one iteration: items give ns/item, bytes give MB/s
+		inline void SetItemsPerIteration(size_t items) noexcept { m_ziItems = items; }
+		inline void SetBytesPerIteration(size_t bytes) noexcept { m_ziBytes = bytes; }
+
+		// Extra named value reported with results (e.g. bytes per value)
+		inline void SetCounter(const std::string& name, double value) { m_vCounters.emplace_back(name, value); }
+
+		inline size_t GetItemsPerIteration() const noexcept { return m_ziItems; }
+		inline size_t GetBytesPerIteration() const noexcept { return m_ziBytes; }
+		inline long long GetNanoseconds() const noexcept { return m_llNanoseconds; }
+		inline const AllocStats_t& GetAllocs() const noexcept { return m_Allocs; }
+		inline const std::vector<std::pair<std::string, double>>& GetCounters() const noexcept
+		{
+			return m_vCounters;
+		}
+
+	private:
+		inline void Start() noexcept
+		{
+			m_bRunning = true;
+			m_bPaused = false;
+			Mark();
+		}
+
+		inline void Stop() noexcept
+		{
+			if (!m_bRunning) return;
+			if (!m_bPaused) Accumulate();
+			m_bRunning = false;
+		}
+
+		inline void Mark() noexcept
+		{
+			m_StartAllocs = GetAllocStats();
+			m_tStart = Clock_t::now();
+		}
+
+		inline void Accumulate() noexcept
+		{
+			const Clock_t::time_point now = Clock_t::now();
+			const AllocStats_t allocs = GetAllocStats();
+			m_llNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_tStart).count();
+			m_Allocs.ziAllocs += allocs.ziAllocs - m_StartAllocs.ziAllocs;
+			m_Allocs.ziBytes += allocs.ziBytes - m_StartAllocs.ziBytes;
+		}
+
+	private:
+		size_t m_ziIterations;
+		size_t m_ziItems;
+		size_t m_ziBytes;
+		bool m_bRunning;
+		bool m_bPaused;
+		long long m_llNanoseconds;
+		AllocStats_t m_Allocs;
+		AllocStats_t m_StartAllocs;
+		Clock_t::time_point m_tStart;
+		std::vector<std::pair<std::string, double>> m_vCounters;
+	};
+
+	// Keeps compiler from dropping computation of value
+	template <typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static const void* volatile g_pSink;
+		g_pSink = &value;
+#endif
+	}
+
+	// Keeps compiler from caching memory across this point
+	inline void ClobberMemory()
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : : "memory");
+#else
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+} // namespace ULTBench
+
+#define __ULTBENCH_CONCAT2(a, b) a##b
+#define __ULTBENCH_CONCAT(a, b) __ULTBENCH_CONCAT2(a, b)
+
+// Defines and registers benchmark:
+//		ULTBENCH("inline/copy/int")(ULTBench::State_t& state) { ... }
+#define ULTBENCH(name)                                                                                                 \
+	static void __ULTBENCH_CONCAT(__ultBench, __LINE__)(ULTBench::State_t&);                                           \
+	static const bool __ULTBENCH_CONCAT(__ultBenchRegistered, __LINE__) =                                              \
+		ULTBench::Register(name, __ULTBENCH_CONCAT(__ultBench, __LINE__));                                             \
+	static void __ULTBENCH_CONCAT(__ultBench, __LINE__)
+
+#endif
@@ -0,0 +1,143 @@
+/*
+============================================
+- File: ultabench_aggregate.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Group-by of 10M rows with few
+  and many keys, against hash map baselines.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultaaggregate.hpp"
+
+#include <random>
+#include <unordered_map>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziRows = 10000000;
+
+	// long long keys and double values, built once per cardinality and shared by its benchmarks
+	struct Rows_t
+	{
+		UltaColumn keys;
+		UltaColumn values;
+
+		inline explicit Rows_t(size_t cardinality)
+		{
+			std::mt19937_64 random(cardinality);
+			keys.Reserve(g_ziRows);
+			values.Reserve(g_ziRows);
+			for (size_t i = 0; i < g_ziRows; i++)
+			{
+				keys.Push<long long>((long long)(random() % cardinality));
+				values.Push<double>((double)(random() % 1000) / 8);
+			}
+		}
+	};
+
+	template <size_t Cardinality>
+	const Rows_t& GetRows()
+	{
+		static const Rows_t g_Rows(Cardinality);
+		return g_Rows;
+	}
+
+	struct Sum_t
+	{
+		size_t ziCount = 0;
+		double dSum = 0;
+	};
+
+	// ns/item is time per row, groups counter checks every version found the same groups
+	template <size_t Cardinality>
+	void RegisterGroupBy(const std::string& cardinality)
+	{
+		const std::string name = "aggregate/group_by/keys:" + cardinality + "/";
+
+		ULTBench::Register(name + "UltaAggregator", [](State_t& state) {
+			const Rows_t& rows = GetRows<Cardinality>();
+			size_t groups = 0;
+			state.SetItemsPerIteration(g_ziRows);
+			for (auto _ : state)
+			{
+				UltaAggregator aggregator;
+				aggregator.Add(rows.keys, rows.values);
+				groups = aggregator.Size();
+				DoNotOptimize(aggregator);
+			}
+			state.SetCounter("groups", (double)groups);
+		});
+
+		ULTBench::Register(name + "Aggregate_pool", [](State_t& state) {
+			const Rows_t& rows = GetRows<Cardinality>();
+			ULTParallel::WorkerPool_t pool;
+			size_t groups = 0;
+			state.SetItemsPerIteration(g_ziRows);
+			for (auto _ : state)
+			{
+				const UltaAggregator aggregator = Aggregate(rows.keys, rows.values, &pool);
+				groups = aggregator.Size();
+				DoNotOptimize(aggregator);
+			}
+			state.SetCounter("groups", (double)groups);
+			state.SetCounter("workers", (double)pool.GetWorkerCount());
+		});
+
+		// What rows of dynamic values take without UltaAggregator: UltaType keys in std::unordered_map
+		ULTBench::Register(name + "unordered_map_UltaType", [](State_t& state) {
+			const Rows_t& rows = GetRows<Cardinality>();
+			size_t groups = 0;
+			state.SetItemsPerIteration(g_ziRows);
+			for (auto _ : state)
+			{
+				std::unordered_map<UltaType, Sum_t> sums;
+				for (size_t i = 0; i < g_ziRows; i++)
+				{
+					Sum_t& sum = sums[UltaType(rows.keys[i])];
+					sum.ziCount++;
+					sum.dSum += UltaType(rows.values[i]).GetValue<double>();
+				}
+				groups = sums.size();
+				DoNotOptimize(sums);
+			}
+			state.SetCounter("groups", (double)groups);
+		});
+
+		// Lower bound: same rows as plain typed arrays
+		ULTBench::Register(name + "unordered_map_native", [](State_t& state) {
+			const Rows_t& rows = GetRows<Cardinality>();
+			const long long* keys = (const long long*)rows.keys.RawData();
+			const double* values = (const double*)rows.values.RawData();
+			size_t groups = 0;
+			state.SetItemsPerIteration(g_ziRows);
+			for (auto _ : state)
+			{
+				std::unordered_map<long long, Sum_t> sums;
+				for (size_t i = 0; i < g_ziRows; i++)
+				{
+					Sum_t& sum = sums[keys[i]];
+					sum.ziCount++;
+					sum.dSum += values[i];
+				}
+				groups = sums.size();
+				DoNotOptimize(sums);
+			}
+			state.SetCounter("groups", (double)groups);
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterGroupBy<16>("16");
+		RegisterGroupBy<1000000>("1M");
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,91 @@
+/*
+============================================
+- File: ultabench_alloc.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Global operator new/delete
+  counting allocations for benchmarks.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<uint64_t> g_aAllocs{0};
+	std::atomic<uint64_t> g_aBytes{0};
+
+	inline void* Allocate(size_t size)
+	{
+		g_aAllocs.fetch_add(1, std::memory_order_relaxed);
+		g_aBytes.fetch_add(size, std::memory_order_relaxed);
+		void* ptr = std::malloc(size ? size : 1);
+		if (!ptr) throw std::bad_alloc();
+		return ptr;
+	}
+
+	inline void* AllocateAligned(size_t size, size_t align)
+	{
+		g_aAllocs.fetch_add(1, std::memory_order_relaxed);
+		g_aBytes.fetch_add(size, std::memory_order_relaxed);
+#ifdef _WIN32
+		void* ptr = _aligned_malloc(size ? size : 1, align);
+#else
+		void* ptr = nullptr;
+		if (posix_memalign(&ptr, align < sizeof(void*) ? sizeof(void*) : align, size ? size : 1)) ptr = nullptr;
+#endif
+		if (!ptr) throw std::bad_alloc();
+		return ptr;
+	}
+
+	inline void FreeAligned(void* ptr) noexcept
+	{
+#ifdef _WIN32
+		_aligned_free(ptr);
+#else
+		std::free(ptr);
+#endif
+	}
+} // namespace
+
+ULTBench::AllocStats_t ULTBench::GetAllocStats() noexcept
+{
+	return AllocStats_t{g_aAllocs.load(std::memory_order_relaxed), g_aBytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(size_t size) { return Allocate(size); }
+void* operator new[](size_t size) { return Allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return Allocate(size);
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#if __cplusplus >= 201703L
+void* operator new(size_t size, std::align_val_t align) { return AllocateAligned(size, (size_t)align); }
+void* operator new[](size_t size, std::align_val_t align) { return AllocateAligned(size, (size_t)align); }
+void operator delete(void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+#endif
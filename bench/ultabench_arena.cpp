@@ -0,0 +1,87 @@
+/*
+============================================
+- File: ultabench_arena.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Request scoped values from
+  arena against global operator new.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultatype.hpp"
+
+#include <memory>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziValues = 10000;
+
+	// Too big for inline buffer, so every value needs a payload block
+	struct Payload_t
+	{
+		double a[6];
+	};
+
+	using MakeResource_t = std::function<std::unique_ptr<ULTMemory::MemoryResource_t>()>;
+
+	// One op builds g_ziValues values like one request would and drops them with their resource.
+	// nullptr resource is the global heap, one block per value.
+	void BuildAndDrop(State_t& state, const MakeResource_t& makeResource, bool bDropOnly)
+	{
+		std::vector<UltaType> values;
+		values.reserve(g_ziValues);
+		const Payload_t payload = {{1, 2, 3, 4, 5, 6}};
+		state.SetItemsPerIteration(g_ziValues);
+		for (auto _ : state)
+		{
+			if (bDropOnly) state.PauseTiming();
+			std::unique_ptr<ULTMemory::MemoryResource_t> resource = makeResource();
+			for (size_t i = 0; i < g_ziValues; i++) values.emplace_back(payload, resource.get());
+			DoNotOptimize(values.data());
+			if (bDropOnly) state.ResumeTiming();
+
+			values.clear();
+			resource.reset();
+		}
+	}
+
+	void RegisterResource(const std::string& name, const MakeResource_t& makeResource)
+	{
+		ULTBench::Register("arena/build_and_drop/" + name,
+						   [makeResource](State_t& state) { BuildAndDrop(state, makeResource, false); });
+		ULTBench::Register("arena/drop/" + name,
+						   [makeResource](State_t& state) { BuildAndDrop(state, makeResource, true); });
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterResource("new", [] { return std::unique_ptr<ULTMemory::MemoryResource_t>(); });
+		RegisterResource("arena", [] {
+			return std::unique_ptr<ULTMemory::MemoryResource_t>(new ULTMemory::ArenaResource_t());
+		});
+#ifdef __ULTATYPE_HAS_MEMORY_RESOURCE
+		// Resource owning its monotonic buffer, so both go away at the end of op
+		struct Monotonic_t final : ULTMemory::MemoryResource_t
+		{
+			std::pmr::monotonic_buffer_resource buffer;
+			ULTMemory::PmrResource_t pmr{&buffer};
+
+			void* Allocate(size_t size, size_t align) override { return pmr.Allocate(size, align); }
+			void Deallocate(void* ptr, size_t size, size_t align) noexcept override
+			{
+				pmr.Deallocate(ptr, size, align);
+			}
+		};
+		RegisterResource("pmr_monotonic",
+						 [] { return std::unique_ptr<ULTMemory::MemoryResource_t>(new Monotonic_t()); });
+#endif
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,167 @@
+/*
+============================================
+- File: ultabench_atomic.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: AtomicUltaType under
+  contention of several threads.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultaatomic.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziOpsPerThread = 1000; // Per op of benchmark
+
+	// Threads waiting for work, every Run calls fn(thread) on all of them at once and waits for the end
+	class Team_t final
+	{
+	public:
+		inline explicit Team_t(size_t threads) : m_aGeneration(0), m_aDone(0), m_bStop(false), m_pFn(nullptr)
+		{
+			for (size_t i = 1; i < threads; i++) m_vThreads.emplace_back([this, i] { Work(i); });
+		}
+		Team_t(const Team_t&) = delete;
+		Team_t& operator=(const Team_t&) = delete;
+		inline ~Team_t()
+		{
+			m_bStop = true;
+			m_aGeneration.fetch_add(1);
+			for (std::thread& thread : m_vThreads) thread.join();
+		}
+
+		inline void Run(const std::function<void(size_t)>& fn)
+		{
+			m_pFn = &fn;
+			m_aDone.store(0);
+			m_aGeneration.fetch_add(1);
+			fn(0);
+			while (m_aDone.load() != m_vThreads.size()) std::this_thread::yield();
+		}
+
+	private:
+		inline void Work(size_t index)
+		{
+			size_t seen = 0;
+			for (;;)
+			{
+				size_t generation;
+				while ((generation = m_aGeneration.load()) == seen) std::this_thread::yield();
+				seen = generation;
+				if (m_bStop) return;
+				(*m_pFn)(index);
+				m_aDone.fetch_add(1);
+			}
+		}
+
+	private:
+		std::vector<std::thread> m_vThreads;
+		std::atomic<size_t> m_aGeneration;
+		std::atomic<size_t> m_aDone;
+		std::atomic<bool> m_bStop;
+		const std::function<void(size_t)>* m_pFn;
+	};
+
+	// Every op runs g_ziOpsPerThread calls of fn on each thread at once, ns/item is time per call
+	void RegisterContended(const std::string& name, const std::function<std::function<void(size_t)>()>& makeFn)
+	{
+		for (size_t threads : {1, 2, 4, 8})
+		{
+			ULTBench::Register(name + "/threads:" + std::to_string(threads), [makeFn, threads](State_t& state) {
+				const std::function<void(size_t)> fn = makeFn();
+				Team_t team(threads);
+				state.SetItemsPerIteration(threads * g_ziOpsPerThread);
+				for (auto _ : state) team.Run(fn);
+			});
+		}
+	}
+
+	template <typename F>
+	std::function<void(size_t)> Repeat(F fn)
+	{
+		return [fn](size_t thread) {
+			for (size_t i = 0; i < g_ziOpsPerThread; i++) fn(thread, i);
+		};
+	}
+
+	// UltaType guarded by mutex, what sharing looks like without AtomicUltaType
+	struct Locked_t
+	{
+		std::mutex mLock;
+		UltaType value;
+	};
+
+	const bool g_bRegistered = [] {
+		RegisterContended("atomic/fetch_add/long_long/AtomicUltaType", [] {
+			std::shared_ptr<AtomicUltaType> counter(new AtomicUltaType(0LL));
+			return Repeat([counter](size_t, size_t) { counter->FetchAdd(1LL); });
+		});
+		RegisterContended("atomic/fetch_add/double/AtomicUltaType", [] {
+			std::shared_ptr<AtomicUltaType> counter(new AtomicUltaType(0.5));
+			return Repeat([counter](size_t, size_t) { counter->FetchAdd(0.25); });
+		});
+		RegisterContended("atomic/fetch_add/long_long/std_atomic", [] {
+			std::shared_ptr<std::atomic<long long>> counter(new std::atomic<long long>(0));
+			return Repeat([counter](size_t, size_t) { counter->fetch_add(1); });
+		});
+		RegisterContended("atomic/fetch_add/long_long/mutex", [] {
+			std::shared_ptr<Locked_t> counter(new Locked_t());
+			counter->value = 0LL;
+			return Repeat([counter](size_t, size_t) {
+				std::lock_guard<std::mutex> lock(counter->mLock);
+				counter->value += UltaType(1LL);
+			});
+		});
+
+		// Thread 0 writes, others read
+		RegisterContended("atomic/load_store/int/AtomicUltaType", [] {
+			std::shared_ptr<AtomicUltaType> value(new AtomicUltaType(0));
+			return Repeat([value](size_t thread, size_t i) {
+				if (thread == 0)
+					value->Store((int)i);
+				else
+					DoNotOptimize(value->Load<int>());
+			});
+		});
+		RegisterContended("atomic/load_store/string/AtomicUltaType", [] {
+			std::shared_ptr<AtomicUltaType> value(new AtomicUltaType(std::string("initial configuration value")));
+			std::shared_ptr<std::vector<UltaType>> strings(new std::vector<UltaType>());
+			for (size_t i = 0; i < 16; i++) strings->emplace_back("configuration value " + std::to_string(i));
+			return Repeat([value, strings](size_t thread, size_t i) {
+				if (thread == 0)
+					value->Store((*strings)[i % 16]);
+				else
+					DoNotOptimize(value->Load());
+			});
+		});
+		RegisterContended("atomic/load_store/string/mutex", [] {
+			std::shared_ptr<Locked_t> value(new Locked_t());
+			value->value = std::string("initial configuration value");
+			std::shared_ptr<std::vector<UltaType>> strings(new std::vector<UltaType>());
+			for (size_t i = 0; i < 16; i++) strings->emplace_back("configuration value " + std::to_string(i));
+			return Repeat([value, strings](size_t thread, size_t i) {
+				std::lock_guard<std::mutex> lock(value->mLock);
+				if (thread == 0)
+					value->value = (*strings)[i % 16];
+				else
+					DoNotOptimize(UltaType(value->value));
+			});
+		});
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,120 @@
+/*
+============================================
+- File: ultabench_batch.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Batch arithmetic against
+  per element UltaType operators.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultacolumn.hpp"
+
+#include <functional>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziCount = 4096;
+
+	template <typename T>
+	std::vector<T> MakeValues(T first)
+	{
+		std::vector<T> res(g_ziCount);
+		for (size_t i = 0; i < g_ziCount; i++) res[i] = (T)(first + (T)(i % 100));
+		return res;
+	}
+
+	// Every benchmark handles g_ziCount elements per op, so ns/item is cost of one element
+	template <typename T, typename Op>
+	void RegisterOperation(const std::string& name, ULTOperations::Operation_t op)
+	{
+		const std::string prefix = "batch/" + name + "/";
+
+		ULTBench::Register(prefix + "native", [](State_t& state) {
+			const std::vector<T> a = MakeValues<T>(3), b = MakeValues<T>(1);
+			std::vector<T> res(g_ziCount);
+			state.SetItemsPerIteration(g_ziCount);
+			for (auto _ : state)
+			{
+				for (size_t i = 0; i < g_ziCount; i++) res[i] = (T)Op()(a[i], b[i]);
+				DoNotOptimize(res.data());
+				ULTBench::ClobberMemory();
+			}
+		});
+
+		ULTBench::Register(prefix + "per_element", [](State_t& state) {
+			const std::vector<T> a = MakeValues<T>(3), b = MakeValues<T>(1);
+			const std::vector<UltaType> aValues(a.begin(), a.end()), bValues(b.begin(), b.end());
+			std::vector<UltaType> res(g_ziCount);
+			state.SetItemsPerIteration(g_ziCount);
+			for (auto _ : state)
+			{
+				for (size_t i = 0; i < g_ziCount; i++) res[i] = Op()(aValues[i], bValues[i]);
+				DoNotOptimize(res.data());
+			}
+		});
+
+		ULTBench::Register(prefix + "span", [op](State_t& state) {
+			const std::vector<T> a = MakeValues<T>(3), b = MakeValues<T>(1);
+			const std::vector<UltaType> aValues(a.begin(), a.end()), bValues(b.begin(), b.end());
+			std::vector<UltaType> res(g_ziCount);
+			state.SetItemsPerIteration(g_ziCount);
+			for (auto _ : state)
+			{
+				ULTOperations::ApplyN(op, aValues.data(), bValues.data(), res.data(), g_ziCount);
+				DoNotOptimize(res.data());
+			}
+		});
+
+		ULTBench::Register(prefix + "column", [op](State_t& state) {
+			const std::vector<T> a = MakeValues<T>(3), b = MakeValues<T>(1);
+			UltaColumn aColumn, bColumn, res;
+			for (size_t i = 0; i < g_ziCount; i++)
+			{
+				aColumn.Push(a[i]);
+				bColumn.Push(b[i]);
+			}
+			ULTOperations::ApplyN(op, aColumn, bColumn, res);
+			state.SetItemsPerIteration(g_ziCount);
+			for (auto _ : state)
+			{
+				ULTOperations::ApplyN(op, aColumn, bColumn, res);
+				DoNotOptimize(res.RawData());
+			}
+		});
+
+		// Typed kernel the column path ends in, without column bookkeeping
+		ULTBench::Register(prefix + "kernel", [op](State_t& state) {
+			const std::vector<T> a = MakeValues<T>(3), b = MakeValues<T>(1);
+			std::vector<T> res(g_ziCount);
+			const int index = (int)ULTReflection::TypeIndex_t<T>::value;
+			const ULTOperations::BatchOperator_t fn =
+				ULTOperations::SelectBatchOperator(*ULTOperations::FindBatchOperators(index, index), op);
+			state.SetItemsPerIteration(g_ziCount);
+			for (auto _ : state)
+			{
+				fn(a.data(), b.data(), res.data(), g_ziCount);
+				DoNotOptimize(res.data());
+				ULTBench::ClobberMemory();
+			}
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		using ULTOperations::Operation_t;
+		RegisterOperation<int, std::plus<>>("plus/int", Operation_t::OPERATION_PLUS);
+		RegisterOperation<double, std::plus<>>("plus/double", Operation_t::OPERATION_PLUS);
+		RegisterOperation<int, std::multiplies<>>("multiply/int", Operation_t::OPERATION_MULTIPLY);
+		RegisterOperation<double, std::multiplies<>>("multiply/double", Operation_t::OPERATION_MULTIPLY);
+		RegisterOperation<float, std::divides<>>("divide/float", Operation_t::OPERATION_DIVIDE);
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,351 @@
+/*
+============================================
+- File: ultabench_core.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Basic operations of UltaType
+  against std::any and std::variant.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultatype.hpp"
+
+#include <any>
+#include <charconv>
+#include <functional>
+#include <variant>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	using Variant_t = std::variant<int, double, std::string>;
+
+	// Longer than any small string buffer, so copies allocate
+	const std::string g_strLong = "a string too long for small buffer";
+
+	// std::any has no dispatch of its own, baselines go through the same closed set of types as Variant_t
+	template <typename F>
+	inline auto VisitAny(const std::any& value, F&& fn)
+	{
+		if (value.type() == typeid(int)) return fn(*std::any_cast<int>(&value));
+		if (value.type() == typeid(double)) return fn(*std::any_cast<double>(&value));
+		return fn(*std::any_cast<std::string>(&value));
+	}
+
+	template <typename F>
+	inline auto VisitAny(const std::any& a, const std::any& b, F&& fn)
+	{
+		return VisitAny(a, [&](const auto& x) { return VisitAny(b, [&](const auto& y) { return fn(x, y); }); });
+	}
+
+	template <typename T>
+	using IsNumber_t = std::is_arithmetic<typename std::decay<T>::type>;
+
+	// Numbers are compared and combined as numbers, anything with a string gives default result
+	template <typename Op, typename R>
+	struct Apply_t
+	{
+		template <typename A, typename B>
+		inline R operator()(const A& a, const B& b) const
+		{
+			if constexpr (IsNumber_t<A>::value && IsNumber_t<B>::value)
+				return R(Op()(a, b));
+			else
+				return R();
+		}
+	};
+
+	template <typename T>
+	inline T ToNumber(const std::string& str)
+	{
+		T res = T();
+		std::from_chars(str.data(), str.data() + str.size(), res);
+		return res;
+	}
+
+	template <typename T>
+	struct Convert_t
+	{
+		template <typename A>
+		inline T operator()(const A& value) const
+		{
+			if constexpr (std::is_same<T, std::string>::value)
+			{
+				if constexpr (std::is_same<A, std::string>::value)
+					return value;
+				else
+					return std::to_string(value);
+			}
+			else if constexpr (std::is_same<A, std::string>::value)
+				return ToNumber<T>(value);
+			else
+				return (T)value;
+		}
+	};
+
+	// Registers UltaType, std::any and std::variant version of one operation on values a and b
+	void RegisterTriplet(const std::string& name, std::function<void(State_t&, const UltaType&, const UltaType&)> ulta,
+						 std::function<void(State_t&, const std::any&, const std::any&)> any,
+						 std::function<void(State_t&, const Variant_t&, const Variant_t&)> variant,
+						 const Variant_t& a, const Variant_t& b)
+	{
+		auto toUlta = [](const Variant_t& value) {
+			return std::visit([](const auto& x) { return UltaType(x); }, value);
+		};
+		auto toAny = [](const Variant_t& value) {
+			return std::visit([](const auto& x) { return std::any(x); }, value);
+		};
+
+		ULTBench::Register(name + "/UltaType", [=](State_t& state) { ulta(state, toUlta(a), toUlta(b)); });
+		ULTBench::Register(name + "/any", [=](State_t& state) { any(state, toAny(a), toAny(b)); });
+		ULTBench::Register(name + "/variant", [=](State_t& state) { variant(state, a, b); });
+	}
+
+	template <typename Op>
+	void RegisterCompare(const std::string& op, const std::string& types, const Variant_t& a, const Variant_t& b)
+	{
+		RegisterTriplet(
+			"core/compare/" + op + "/" + types,
+			[](State_t& state, const UltaType& x, const UltaType& y) {
+				for (auto _ : state) DoNotOptimize(Op()(x, y));
+			},
+			[](State_t& state, const std::any& x, const std::any& y) {
+				for (auto _ : state) DoNotOptimize(VisitAny(x, y, Apply_t<Op, bool>()));
+			},
+			[](State_t& state, const Variant_t& x, const Variant_t& y) {
+				for (auto _ : state) DoNotOptimize(std::visit(Apply_t<Op, bool>(), x, y));
+			},
+			a, b);
+	}
+
+	template <typename Op>
+	void RegisterArithmetic(const std::string& op, const std::string& types, const Variant_t& a, const Variant_t& b)
+	{
+		// Result keeps type of left operand, like UltaType operators
+		RegisterTriplet(
+			"core/arithmetic/" + op + "/" + types,
+			[](State_t& state, const UltaType& x, const UltaType& y) {
+				for (auto _ : state) DoNotOptimize(Op()(x, y));
+			},
+			[](State_t& state, const std::any& x, const std::any& y) {
+				for (auto _ : state)
+				{
+					const std::any res = VisitAny(x, y, [](const auto& l, const auto& r) {
+						using L = typename std::decay<decltype(l)>::type;
+						return std::any(Apply_t<Op, L>()(l, r));
+					});
+					DoNotOptimize(res);
+				}
+			},
+			[](State_t& state, const Variant_t& x, const Variant_t& y) {
+				for (auto _ : state)
+				{
+					const Variant_t res = std::visit(
+						[](const auto& l, const auto& r) {
+							using L = typename std::decay<decltype(l)>::type;
+							return Variant_t(Apply_t<Op, L>()(l, r));
+						},
+						x, y);
+					DoNotOptimize(res);
+				}
+			},
+			a, b);
+	}
+
+	template <typename T>
+	void RegisterGetValue(const std::string& name, const Variant_t& value)
+	{
+		RegisterTriplet(
+			"core/get_value/" + name,
+			[](State_t& state, const UltaType& x, const UltaType&) {
+				for (auto _ : state) DoNotOptimize(x.GetValue<T>());
+			},
+			[](State_t& state, const std::any& x, const std::any&) {
+				for (auto _ : state)
+				{
+					const std::any* p = &x;
+					DoNotOptimize(p);
+					DoNotOptimize(VisitAny(*p, Convert_t<T>()));
+				}
+			},
+			[](State_t& state, const Variant_t& x, const Variant_t&) {
+				for (auto _ : state)
+				{
+					const Variant_t* p = &x;
+					DoNotOptimize(p);
+					DoNotOptimize(std::visit(Convert_t<T>(), *p));
+				}
+			},
+			value, value);
+	}
+
+	template <typename T>
+	void RegisterLifetime(const std::string& types, const T& value)
+	{
+		const Variant_t v(value);
+		RegisterTriplet(
+			"core/construct/" + types,
+			[value](State_t& state, const UltaType&, const UltaType&) {
+				for (auto _ : state)
+				{
+					UltaType res(value);
+					DoNotOptimize(res);
+				}
+			},
+			[value](State_t& state, const std::any&, const std::any&) {
+				for (auto _ : state)
+				{
+					std::any res(value);
+					DoNotOptimize(res);
+				}
+			},
+			[value](State_t& state, const Variant_t&, const Variant_t&) {
+				for (auto _ : state)
+				{
+					Variant_t res(value);
+					DoNotOptimize(res);
+				}
+			},
+			v, v);
+
+		RegisterTriplet(
+			"core/copy/" + types,
+			[](State_t& state, const UltaType& x, const UltaType&) {
+				for (auto _ : state)
+				{
+					UltaType res(x);
+					DoNotOptimize(res);
+				}
+			},
+			[](State_t& state, const std::any& x, const std::any&) {
+				for (auto _ : state)
+				{
+					std::any res(x);
+					DoNotOptimize(res);
+				}
+			},
+			[](State_t& state, const Variant_t& x, const Variant_t&) {
+				for (auto _ : state)
+				{
+					Variant_t res(x);
+					DoNotOptimize(res);
+				}
+			},
+			v, v);
+
+		// One move construction and one move assignment per op
+		RegisterTriplet(
+			"core/move/" + types,
+			[](State_t& state, const UltaType& x, const UltaType&) {
+				UltaType a(x);
+				for (auto _ : state)
+				{
+					UltaType b(std::move(a));
+					a = std::move(b);
+					DoNotOptimize(a);
+				}
+			},
+			[](State_t& state, const std::any& x, const std::any&) {
+				std::any a(x);
+				for (auto _ : state)
+				{
+					std::any b(std::move(a));
+					a = std::move(b);
+					DoNotOptimize(a);
+				}
+			},
+			[](State_t& state, const Variant_t& x, const Variant_t&) {
+				Variant_t a(x);
+				for (auto _ : state)
+				{
+					Variant_t b(std::move(a));
+					a = std::move(b);
+					DoNotOptimize(a);
+				}
+			},
+			v, v);
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterLifetime("int", 42);
+		RegisterLifetime("double", 2.5);
+		RegisterLifetime("string", g_strLong);
+
+		// Every op stores a value of other type than the one held
+		RegisterTriplet(
+			"core/set_value/type_change",
+			[](State_t& state, const UltaType&, const UltaType&) {
+				UltaType v(0);
+				size_t i = 0;
+				for (auto _ : state)
+				{
+					if (i++ & 1)
+						v.SetValue(1);
+					else
+						v.SetValue(1.5);
+					DoNotOptimize(v);
+				}
+			},
+			[](State_t& state, const std::any&, const std::any&) {
+				std::any v(0);
+				size_t i = 0;
+				for (auto _ : state)
+				{
+					if (i++ & 1)
+						v = 1;
+					else
+						v = 1.5;
+					DoNotOptimize(v);
+				}
+			},
+			[](State_t& state, const Variant_t&, const Variant_t&) {
+				Variant_t v(0);
+				size_t i = 0;
+				for (auto _ : state)
+				{
+					if (i++ & 1)
+						v = 1;
+					else
+						v = 1.5;
+					DoNotOptimize(v);
+				}
+			},
+			Variant_t(0), Variant_t(0));
+
+		RegisterGetValue<int>("same/int", Variant_t(42));
+		RegisterGetValue<double>("convert/int_to_double", Variant_t(42));
+		RegisterGetValue<int>("convert/double_to_int", Variant_t(2.5));
+		RegisterGetValue<std::string>("string/int_to_string", Variant_t(123456));
+		RegisterGetValue<int>("string/string_to_int", Variant_t(std::string("123456")));
+		RegisterGetValue<double>("string/string_to_double", Variant_t(std::string("1234.5625")));
+
+		const Variant_t i7(7), i3(3), d3(3.5);
+		RegisterCompare<std::equal_to<>>("eq", "int_int", i7, i3);
+		RegisterCompare<std::less<>>("lt", "int_int", i7, i3);
+		RegisterCompare<std::less_equal<>>("le", "int_int", i7, i3);
+		RegisterCompare<std::greater<>>("gt", "int_int", i7, i3);
+		RegisterCompare<std::greater_equal<>>("ge", "int_int", i7, i3);
+		RegisterCompare<std::equal_to<>>("eq", "int_double", i7, d3);
+		RegisterCompare<std::less<>>("lt", "int_double", i7, d3);
+		RegisterCompare<std::less_equal<>>("le", "int_double", i7, d3);
+		RegisterCompare<std::greater<>>("gt", "int_double", i7, d3);
+		RegisterCompare<std::greater_equal<>>("ge", "int_double", i7, d3);
+
+		RegisterArithmetic<std::plus<>>("plus", "int_int", i7, i3);
+		RegisterArithmetic<std::minus<>>("minus", "int_int", i7, i3);
+		RegisterArithmetic<std::multiplies<>>("multiply", "int_int", i7, i3);
+		RegisterArithmetic<std::divides<>>("divide", "int_int", i7, i3);
+		RegisterArithmetic<std::plus<>>("plus", "int_double", i7, d3);
+		RegisterArithmetic<std::minus<>>("minus", "int_double", i7, d3);
+		RegisterArithmetic<std::multiplies<>>("multiply", "int_double", i7, d3);
+		RegisterArithmetic<std::divides<>>("divide", "int_double", i7, d3);
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,79 @@
+/*
+============================================
+- File: ultabench_cow.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Copying big value to many
+  consumers, with and without shared payloads.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultatype.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+// Built into ultabench as is and into ultabench_shared with ULTATYPE_SHARED_PAYLOADS, names tell them apart
+#ifdef ULTATYPE_SHARED_PAYLOADS
+#define __ULTABENCH_COW_MODE "shared"
+#else
+#define __ULTABENCH_COW_MODE "plain"
+#endif
+
+namespace
+{
+	constexpr size_t g_ziPayloadSize = 4096; // Bytes
+
+	// Every op copies value to all consumers and reads each of them, every mutateEvery-th consumer also changes
+	// its copy. 0 means nobody changes it.
+	template <typename T>
+	void RegisterFanOut(const std::string& payload, const T& value, size_t (*sizeOf)(const T&))
+	{
+		for (size_t consumers : {16, 256})
+		{
+			for (size_t mutateEvery : {0, 16, 1})
+			{
+				const std::string access = mutateEvery == 0 ? "read" : mutateEvery == 1 ? "mutate_all" : "mutate_1_16";
+				const std::string name = "cow/fan_out/" + payload + "/" + access + "/consumers:" +
+										 std::to_string(consumers) + "/" + __ULTABENCH_COW_MODE;
+				ULTBench::Register(name, [value, sizeOf, consumers, mutateEvery](State_t& state) {
+					const UltaType source(value);
+					std::vector<UltaType> copies(consumers);
+					state.SetItemsPerIteration(consumers);
+					for (auto _ : state)
+					{
+						for (UltaType& copy : copies) copy = source;
+
+						size_t total = 0;
+						for (size_t i = 0; i < consumers; i++)
+						{
+							// Views read without taking own copy of shared payload
+							const UltaTypeView view(copies[i]);
+							total += sizeOf(view.GetValueHard<T>());
+							if (mutateEvery && i % mutateEvery == 0) (*copies[i].GetPointer<T>())[0] = 1;
+						}
+						DoNotOptimize(total);
+
+						for (UltaType& copy : copies) copy.Reset();
+					}
+				});
+			}
+		}
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterFanOut<std::string>("string_4k", std::string(g_ziPayloadSize, 'x'),
+									[](const std::string& str) { return str.size(); });
+		RegisterFanOut<std::vector<int>>("vector_int_4k", std::vector<int>(g_ziPayloadSize / sizeof(int), 7),
+										 [](const std::vector<int>& vec) { return vec.size(); });
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,123 @@
+/*
+============================================
+- File: ultabench_csv.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: CSV reading throughput in
+  MB/s, numeric and mixed input.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultacsv.hpp"
+
+#include <cstdio>
+#include <random>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziRows = 100000;
+	constexpr size_t g_ziChunk = 64 * 1024; // Input is fed in chunks of this size, like read from file
+
+	// Columns: int, long long, double, int, double, int
+	std::string MakeNumeric()
+	{
+		std::mt19937_64 rng(1);
+		std::string res;
+		char line[256];
+		for (size_t i = 0; i < g_ziRows; i++)
+		{
+			snprintf(line, sizeof(line), "%d,%lld,%.6f,%d,%.3f,%d\n", (int)(rng() % 100000),
+					 (long long)(rng() >> 4), (double)(rng() % 1000000) / 7.0, (int)(rng() % 100) - 50,
+					 (double)(rng() % 10000) / 8.0, (int)i);
+			res += line;
+		}
+		return res;
+	}
+
+	// Columns: int, string, quoted string with delimiter, double, empty or int
+	std::string MakeMixed()
+	{
+		std::mt19937_64 rng(2);
+		std::string res;
+		char line[256];
+		for (size_t i = 0; i < g_ziRows; i++)
+		{
+			const unsigned long long r = rng();
+			snprintf(line, sizeof(line), "%d,name_%llu,\"%llu, \"\"quoted\"\"\",%.4f,%s\n", (int)(r % 1000),
+					 r % 5000, r % 77, (double)(r % 100000) / 3.0, (r & 1) ? "" : "42");
+			res += line;
+		}
+		return res;
+	}
+
+	template <typename F>
+	void Read(const std::string& input, UltaCsvReader& reader, F& onField)
+	{
+		for (size_t i = 0; i < input.size(); i += g_ziChunk)
+			reader.Feed(input.data() + i, std::min(g_ziChunk, input.size() - i), onField);
+		reader.Finish(onField);
+	}
+
+	void RegisterInput(const std::string& name, std::string (*makeInput)())
+	{
+		// Splitting and type inference only
+		ULTBench::Register("csv/tokenize/" + name, [makeInput](State_t& state) {
+			const std::string input = makeInput();
+			state.SetBytesPerIteration(input.size());
+			for (auto _ : state)
+			{
+				UltaCsvReader reader;
+				size_t types = 0;
+				auto onField = [&types](const ULTCsv::Field_t& field) { types += (size_t)field.value.GetTypeIndex(); };
+				Read(input, reader, onField);
+				DoNotOptimize(types);
+			}
+		});
+
+		ULTBench::Register("csv/columns/" + name, [makeInput](State_t& state) {
+			const std::string input = makeInput();
+			state.SetBytesPerIteration(input.size());
+			for (auto _ : state)
+			{
+				UltaCsvReader reader;
+				UltaCsvColumns columns;
+				Read(input, reader, columns);
+				DoNotOptimize(columns.GetColumns().data());
+			}
+		});
+
+		// What reading looked like before UltaCsvReader: every field kept as std::string, unquoted naively
+		ULTBench::Register("csv/string_fields/" + name, [makeInput](State_t& state) {
+			const std::string input = makeInput();
+			state.SetBytesPerIteration(input.size());
+			for (auto _ : state)
+			{
+				std::vector<UltaType> fields;
+				const char* p = input.data();
+				const char* const end = p + input.size();
+				while (p < end)
+				{
+					const char* q = p;
+					while (q < end && *q != ',' && *q != '\n') q++;
+					fields.emplace_back(std::string(p, q));
+					p = q + 1;
+				}
+				DoNotOptimize(fields.data());
+			}
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterInput("numeric", MakeNumeric);
+		RegisterInput("mixed", MakeMixed);
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,79 @@
+/*
+============================================
+- File: ultabench_inline.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Allocations of UltaType
+  holding every BaseTypes_t type.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultatype.hpp"
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	// Numbers are kept in the inline buffer, so every benchmark of them should show 0 allocs/op
+	template <typename T>
+	void RegisterType(const std::string& type, const T& value, const T& other)
+	{
+		ULTBench::Register("inline/construct/" + type, [value](State_t& state) {
+			for (auto _ : state)
+			{
+				UltaType res(value);
+				DoNotOptimize(res);
+			}
+		});
+
+		ULTBench::Register("inline/copy/" + type, [value](State_t& state) {
+			const UltaType source(value);
+			for (auto _ : state)
+			{
+				UltaType res(source);
+				DoNotOptimize(res);
+			}
+		});
+
+		// Assigns other type first, so every op replaces payload
+		ULTBench::Register("inline/set_value/" + type, [value](State_t& state) {
+			UltaType res;
+			for (auto _ : state)
+			{
+				res.SetValue(0);
+				res.SetValue(value);
+				DoNotOptimize(res);
+			}
+		});
+
+		ULTBench::Register("inline/plus/" + type, [value, other](State_t& state) {
+			const UltaType a(value), b(other);
+			for (auto _ : state) DoNotOptimize(a + b);
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterType<char>("char", 'a', 1);
+		RegisterType<short>("short", 1000, 3);
+		RegisterType<int>("int", 100000, 3);
+		RegisterType<long>("long", 100000, 3);
+		RegisterType<long long>("long_long", 1LL << 40, 3);
+		RegisterType<unsigned char>("unsigned_char", 200, 3);
+		RegisterType<unsigned short>("unsigned_short", 60000, 3);
+		RegisterType<unsigned int>("unsigned_int", 4000000000u, 3);
+		RegisterType<unsigned long>("unsigned_long", 4000000000ul, 3);
+		RegisterType<unsigned long long>("unsigned_long_long", 1ULL << 60, 3);
+		RegisterType<float>("float", 1.5f, 0.25f);
+		RegisterType<double>("double", 1.5, 0.25);
+		RegisterType<long double>("long_double", 1.5L, 0.25L);
+		// Doesn't fit inline buffer, shown for comparison
+		RegisterType<std::string>("string", "a string too long for small buffer", "!");
+		return true;
+	}();
+} // namespace
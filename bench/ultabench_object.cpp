@@ -0,0 +1,131 @@
+/*
+============================================
+- File: ultabench_object.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaObject field access by handle
+  and by name, against std::map of fields.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultaobject.hpp"
+
+#include <map>
+#include <unordered_map>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziObjects = 1024;
+
+	const char* const g_aszFields[] = {"id", "name", "price", "quantity", "tax", "region", "created", "flags"};
+	constexpr size_t g_ziFields = sizeof(g_aszFields) / sizeof(g_aszFields[0]);
+	const char* const g_szRead = "region";
+
+	// Object i gets the fields rotated by i % shapes, so shapes:1 is all of one shape and shapes:4 mixes four
+	inline size_t FieldOf(size_t object, size_t field, size_t shapes) { return (field + object % shapes) % g_ziFields; }
+
+	std::vector<UltaObject> MakeObjects(size_t shapes)
+	{
+		std::vector<UltaObject> objects(g_ziObjects);
+		for (size_t i = 0; i < g_ziObjects; i++)
+			for (size_t f = 0; f < g_ziFields; f++) objects[i].Set(g_aszFields[FieldOf(i, f, shapes)], (double)f);
+		return objects;
+	}
+
+	template <typename Map>
+	std::vector<Map> MakeMaps(size_t shapes)
+	{
+		std::vector<Map> maps(g_ziObjects);
+		for (size_t i = 0; i < g_ziObjects; i++)
+			for (size_t f = 0; f < g_ziFields; f++) maps[i][g_aszFields[FieldOf(i, f, shapes)]] = (double)f;
+		return maps;
+	}
+
+	// Every op reads (or assigns) one field of each of g_ziObjects records, ns/item is time per access
+	void RegisterAccess(size_t shapes)
+	{
+		const std::string suffix = "/shapes:" + std::to_string(shapes);
+
+		ULTBench::Register("object/read/handle" + suffix, [shapes](State_t& state) {
+			std::vector<UltaObject> objects = MakeObjects(shapes);
+			const ULTObject::Field_t field(g_szRead);
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+			{
+				double sum = 0;
+				for (UltaObject& object : objects) sum += UltaTypeView(*object.Find(field)).GetValueHard<double>();
+				DoNotOptimize(sum);
+			}
+		});
+		ULTBench::Register("object/read/name" + suffix, [shapes](State_t& state) {
+			std::vector<UltaObject> objects = MakeObjects(shapes);
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+			{
+				double sum = 0;
+				for (UltaObject& object : objects) sum += UltaTypeView(*object.Find(g_szRead)).GetValueHard<double>();
+				DoNotOptimize(sum);
+			}
+		});
+		ULTBench::Register("object/read/std_map" + suffix, [shapes](State_t& state) {
+			std::vector<std::map<std::string, UltaType>> maps = MakeMaps<std::map<std::string, UltaType>>(shapes);
+			const std::string key = g_szRead;
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+			{
+				double sum = 0;
+				for (const std::map<std::string, UltaType>& map : maps)
+					sum += UltaTypeView(map.find(key)->second).GetValueHard<double>();
+				DoNotOptimize(sum);
+			}
+		});
+		ULTBench::Register("object/read/std_unordered_map" + suffix, [shapes](State_t& state) {
+			std::vector<std::unordered_map<std::string, UltaType>> maps =
+				MakeMaps<std::unordered_map<std::string, UltaType>>(shapes);
+			const std::string key = g_szRead;
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+			{
+				double sum = 0;
+				for (const std::unordered_map<std::string, UltaType>& map : maps)
+					sum += UltaTypeView(map.find(key)->second).GetValueHard<double>();
+				DoNotOptimize(sum);
+			}
+		});
+
+		ULTBench::Register("object/write/handle" + suffix, [shapes](State_t& state) {
+			std::vector<UltaObject> objects = MakeObjects(shapes);
+			const ULTObject::Field_t field(g_szRead);
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+				for (UltaObject& object : objects) DoNotOptimize(object.Set(field, 2.5));
+		});
+		ULTBench::Register("object/write/name" + suffix, [shapes](State_t& state) {
+			std::vector<UltaObject> objects = MakeObjects(shapes);
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+				for (UltaObject& object : objects) DoNotOptimize(object.Set(g_szRead, 2.5));
+		});
+		ULTBench::Register("object/write/std_map" + suffix, [shapes](State_t& state) {
+			std::vector<std::map<std::string, UltaType>> maps = MakeMaps<std::map<std::string, UltaType>>(shapes);
+			const std::string key = g_szRead;
+			state.SetItemsPerIteration(g_ziObjects);
+			for (auto _ : state)
+				for (std::map<std::string, UltaType>& map : maps) DoNotOptimize(map[key] = 2.5);
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterAccess(1);
+		RegisterAccess(4);
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,100 @@
+/*
+============================================
+- File: ultabench_scalar.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Memory per value and scan speed
+  of UltaScalar against UltaType.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultascalar.hpp"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziValues = 1000000;
+
+	enum class Data_t : int
+	{
+		DATA_DOUBLE, // Only doubles
+		DATA_NUMBERS, // int, long long, float and double in turn
+		DATA_STRINGS, // Doubles with every 64th value a string
+	};
+
+	template <typename V>
+	inline V MakeValue(Data_t data, size_t i)
+	{
+		switch (data)
+		{
+		case Data_t::DATA_DOUBLE:
+			return V((double)i * 0.5);
+		case Data_t::DATA_NUMBERS:
+			switch (i & 3)
+			{
+			case 0:
+				return V((int)i);
+			case 1:
+				return V((long long)i);
+			case 2:
+				return V((float)i);
+			default:
+				return V((double)i);
+			}
+		case Data_t::DATA_STRINGS:
+			if (i % 64 == 0) return V(std::to_string(i));
+			return V((double)i * 0.5);
+		}
+		return V();
+	}
+
+	// bytes_per_value counter is element size plus heap allocated by values themselves,
+	// ns/item and MB/s are of summing every value as double
+	template <typename V>
+	void RegisterScan(const std::string& data, Data_t kind)
+	{
+		const std::string type = std::is_same<V, UltaScalar>::value ? "UltaScalar" : "UltaType";
+		ULTBench::Register("scalar/scan/" + data + "/" + type, [kind](State_t& state) {
+			std::vector<V> values;
+			values.reserve(g_ziValues);
+			const ULTBench::AllocStats_t before = ULTBench::GetAllocStats();
+			for (size_t i = 0; i < g_ziValues; i++) values.push_back(MakeValue<V>(kind, i));
+			const uint64_t heap = ULTBench::GetAllocStats().ziBytes - before.ziBytes;
+
+			state.SetItemsPerIteration(g_ziValues);
+			state.SetBytesPerIteration(g_ziValues * sizeof(V));
+			for (auto _ : state)
+			{
+				double sum = 0;
+				for (const V& value : values)
+				{
+					double number;
+					if (value.TryGetAs(number)) sum += number;
+				}
+				DoNotOptimize(sum);
+			}
+			state.SetCounter("bytes_per_value", (double)sizeof(V) + (double)heap / g_ziValues);
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterScan<UltaScalar>("double", Data_t::DATA_DOUBLE);
+		RegisterScan<UltaType>("double", Data_t::DATA_DOUBLE);
+		RegisterScan<UltaScalar>("numbers", Data_t::DATA_NUMBERS);
+		RegisterScan<UltaType>("numbers", Data_t::DATA_NUMBERS);
+		RegisterScan<UltaScalar>("strings_1_64", Data_t::DATA_STRINGS);
+		RegisterScan<UltaType>("strings_1_64", Data_t::DATA_STRINGS);
+		return true;
+	}();
+} // namespace
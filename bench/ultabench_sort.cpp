@@ -0,0 +1,94 @@
+/*
+============================================
+- File: ultabench_sort.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: ULT::Sort of 10M values against
+  std::stable_sort with TotalLess_t.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultasort.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ULT;
+using ULTBench::DoNotOptimize;
+using ULTBench::State_t;
+
+namespace
+{
+	constexpr size_t g_ziValues = 10000000;
+
+	enum class Data_t : int
+	{
+		DATA_LONGLONG, // Random long long
+		DATA_DOUBLE, // Random double
+		DATA_MIXED, // int, long long and double in turn, every 16th value a string
+	};
+
+	std::vector<UltaType> MakeValues(Data_t data)
+	{
+		std::mt19937_64 random(42);
+		std::vector<UltaType> values;
+		values.reserve(g_ziValues);
+		for (size_t i = 0; i < g_ziValues; i++)
+		{
+			const unsigned long long bits = random();
+			if (data == Data_t::DATA_LONGLONG)
+				values.emplace_back((long long)bits);
+			else if (data == Data_t::DATA_DOUBLE)
+				values.emplace_back((double)(long long)bits / 1e6);
+			else if (i % 16 == 0)
+				values.emplace_back(std::to_string(bits % 100000));
+			else if (i % 3 == 0)
+				values.emplace_back((int)(bits % 1000000) - 500000);
+			else if (i % 3 == 1)
+				values.emplace_back((long long)(bits % 1000000) - 500000);
+			else
+				values.emplace_back((double)(bits % 100000000) / 100 - 500000);
+		}
+		return values;
+	}
+
+	// Every op sorts a fresh copy of the input, copying isn't timed. ns/item is time per value.
+	template <typename F>
+	void RegisterSort(const std::string& name, Data_t data, F sort)
+	{
+		ULTBench::Register(name, [data, sort](State_t& state) {
+			const std::vector<UltaType> input = MakeValues(data);
+			std::vector<UltaType> values;
+			state.SetItemsPerIteration(g_ziValues);
+			for (auto _ : state)
+			{
+				state.PauseTiming();
+				values = input;
+				state.ResumeTiming();
+				sort(values);
+				DoNotOptimize(values.data());
+			}
+		});
+	}
+
+	void RegisterData(const std::string& name, Data_t data)
+	{
+		RegisterSort("sort/" + name + "/ULT_Sort", data, [](std::vector<UltaType>& values) { Sort(values); });
+		RegisterSort("sort/" + name + "/std_stable_sort", data, [](std::vector<UltaType>& values) {
+			std::stable_sort(values.begin(), values.end(), ULTSort::TotalLess_t());
+		});
+	}
+
+	const bool g_bRegistered = [] {
+		RegisterData("long_long", Data_t::DATA_LONGLONG);
+		RegisterData("double", Data_t::DATA_DOUBLE);
+		RegisterData("mixed", Data_t::DATA_MIXED);
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,76 @@
+/*
+============================================
+- File: ultabench_startup.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Startup cost against number
+  of units including ultatype.hpp.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include "ultabench_startup.h"
+
+#include <cstdio>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+using ULTBench::State_t;
+
+namespace
+{
+	struct Program_t
+	{
+		int iUnits;
+		const char* szPath;
+	};
+
+	// ns/op is wall time of whole program run, counters are its static initialization
+	void RunProgram(State_t& state, const char* path)
+	{
+		long long initNs = 0;
+		unsigned long long allocs = 0;
+		unsigned long long bytes = 0;
+		size_t runs = 0;
+		for (auto _ : state)
+		{
+			FILE* pipe = popen(path, "r");
+			if (!pipe) continue;
+
+			long long ns;
+			unsigned long long a, b;
+			int sum;
+			if (fscanf(pipe, "%lld %llu %llu %d", &ns, &a, &b, &sum) == 4)
+			{
+				initNs += ns;
+				allocs += a;
+				bytes += b;
+				runs++;
+			}
+			pclose(pipe);
+		}
+
+		if (!runs) return;
+		state.SetCounter("init_ns", (double)initNs / runs);
+		state.SetCounter("init_allocs", (double)allocs / runs);
+		state.SetCounter("init_bytes", (double)bytes / runs);
+	}
+
+	const bool g_bRegistered = [] {
+		const Program_t programs[] = ULTABENCH_STARTUP_PROGRAMS;
+		for (const Program_t& program : programs)
+		{
+			char name[64];
+			snprintf(name, sizeof(name), "startup/units:%04d", program.iUnits);
+			const std::string path = std::string("\"") + program.szPath + "\"";
+			ULTBench::Register(name, [path](State_t& state) { RunProgram(state, path.c_str()); });
+		}
+		return true;
+	}();
+} // namespace
@@ -0,0 +1,48 @@
+/*
+============================================
+- File: ultabench_startup_main.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Program run by startup
+  benchmarks, reports its static init.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultabench.hpp"
+
+#include <cstdio>
+
+// Defined in generated units_<N>.cpp, calls every unit so none is dropped by linker
+int ultabench_startup_units();
+
+namespace
+{
+	// Constructed before statics of generated units, where init_priority is supported
+	struct Mark_t
+	{
+		std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+		ULTBench::AllocStats_t allocs = ULTBench::GetAllocStats();
+	};
+
+#if defined(__GNUC__) || defined(__clang__)
+	const Mark_t g_Mark __attribute__((init_priority(101)));
+#else
+	const Mark_t g_Mark;
+#endif
+} // namespace
+
+// Prints nanoseconds, allocations and allocated bytes of static initialization
+int main()
+{
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	const ULTBench::AllocStats_t allocs = ULTBench::GetAllocStats();
+	const int sum = ultabench_startup_units();
+
+	printf("%lld %llu %llu %d\n",
+		   (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(now - g_Mark.tStart).count(),
+		   (unsigned long long)(allocs.ziAllocs - g_Mark.allocs.ziAllocs),
+		   (unsigned long long)(allocs.ziBytes - g_Mark.allocs.ziBytes), sum);
+	return 0;
+}
@@ -0,0 +1,301 @@
+/*
+============================================
+- File: ultaaggregate.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaAggregator groups rows
+  by key and sums up their values.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTAAGGREGATE_HPP
+#define ULTAAGGREGATE_HPP
+
+#include "ultahashmap.hpp"
+#include "ultaparallel.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+// Rows handled by one task of ULT::Aggregate
+#ifndef ULTATYPE_AGGREGATE_CHUNK_ROWS
+#define ULTATYPE_AGGREGATE_CHUNK_ROWS 16384
+#endif
+
+namespace ULT
+{
+	namespace ULTAggregate
+	{
+		// Count, sum, min, max and average of one group. Integers are summed exactly in long long
+		// (wrapping on overflow), floating point values and unsigned ones above LLONG_MAX in double.
+		struct Aggregate_t
+		{
+			size_t ziCount;	   // Rows, including empty and not numeric values
+			size_t ziIntegers; // Values summed in iSum
+			size_t ziFloats;   // Values summed in fSum
+			long long iSum;
+			long long iMin;
+			long long iMax;
+			double fSum;
+			double fMin;
+			double fMax;
+
+			inline Aggregate_t() noexcept
+				: ziCount(0), ziIntegers(0), ziFloats(0), iSum(0), iMin(0), iMax(0), fSum(0), fMin(0), fMax(0)
+			{
+			}
+
+			inline void AddInteger(long long value) noexcept
+			{
+				iSum = (long long)((unsigned long long)iSum + (unsigned long long)value);
+				if (!ziIntegers || value < iMin) iMin = value;
+				if (!ziIntegers || value > iMax) iMax = value;
+				ziIntegers++;
+			}
+
+			inline void AddFloating(double value) noexcept
+			{
+				fSum += value;
+				if (!ziFloats || value < fMin) fMin = value;
+				if (!ziFloats || value > fMax) fMax = value;
+				ziFloats++;
+			}
+
+			inline void Merge(const Aggregate_t& other) noexcept
+			{
+				ziCount += other.ziCount;
+				if (other.ziIntegers)
+				{
+					iSum = (long long)((unsigned long long)iSum + (unsigned long long)other.iSum);
+					if (!ziIntegers || other.iMin < iMin) iMin = other.iMin;
+					if (!ziIntegers || other.iMax > iMax) iMax = other.iMax;
+					ziIntegers += other.ziIntegers;
+				}
+				if (other.ziFloats)
+				{
+					fSum += other.fSum;
+					if (!ziFloats || other.fMin < fMin) fMin = other.fMin;
+					if (!ziFloats || other.fMax > fMax) fMax = other.fMax;
+					ziFloats += other.ziFloats;
+				}
+			}
+
+			inline size_t GetNumberCount() const noexcept { return ziIntegers + ziFloats; }
+
+			// long long if every value was integer, double otherwise, empty if group had no numbers
+			inline UltaType GetSum() const
+			{
+				if (!ziFloats) return ziIntegers ? UltaType(iSum) : UltaType();
+				return UltaType((double)iSum + fSum);
+			}
+
+			inline UltaType GetMin() const { return Pick(iMin, fMin, -1); }
+			inline UltaType GetMax() const { return Pick(iMax, fMax, 1); }
+
+			// NaN if group had no numbers
+			inline double GetAverage() const noexcept
+			{
+				const size_t count = GetNumberCount();
+				return count ? ((double)iSum + fSum) / (double)count : std::numeric_limits<double>::quiet_NaN();
+			}
+
+		private:
+			// Integer and floating candidates are compared exactly, winner keeps its type
+			inline UltaType Pick(long long integer, double floating, int side) const
+			{
+				if (!ziFloats) return ziIntegers ? UltaType(integer) : UltaType();
+				if (!ziIntegers) return UltaType(floating);
+
+				ULTReflection::Number_t a, b;
+				ULTReflection::__ultSetNumber(integer, a);
+				ULTReflection::__ultSetNumber(floating, b);
+				return ULTCompare::CompareNumbers(a, b) == side ? UltaType(integer) : UltaType(floating);
+			}
+		};
+
+		// Adds value of some type to aggregate, one per numeric BaseTypes_t
+		using Accumulator_t = void (*)(Aggregate_t& aggregate, const void* value);
+
+		template <typename V>
+		inline void __ultAccumulate(Aggregate_t& aggregate, const void* value, std::true_type /*integer*/) noexcept
+		{
+			const V v = *(const V*)value;
+			const unsigned long long uiMax = (unsigned long long)std::numeric_limits<long long>::max();
+			if (!std::is_signed<V>::value && (unsigned long long)v > uiMax)
+				aggregate.AddFloating((double)v);
+			else
+				aggregate.AddInteger((long long)v);
+		}
+
+		template <typename V>
+		inline void __ultAccumulate(Aggregate_t& aggregate, const void* value, std::false_type /*integer*/) noexcept
+		{
+			aggregate.AddFloating((double)*(const V*)value);
+		}
+
+		template <typename V>
+		inline void __ultAccumulate(Aggregate_t& aggregate, const void* value) noexcept
+		{
+			__ultAccumulate<V>(aggregate, value, std::is_integral<V>());
+		}
+
+		// nullptr for types that are only counted
+		inline Accumulator_t GetAccumulator(int typeIndex) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			switch ((BaseTypes_t)typeIndex)
+			{
+#define __ULTATYPE_AGGREGATE_CASE(type, index)                                                                         \
+	case BaseTypes_t::index:                                                                                           \
+		return __ultAccumulate<type>;
+				__ULTATYPE_AGGREGATE_CASE(char, TYPE_CHAR)
+				__ULTATYPE_AGGREGATE_CASE(short, TYPE_SHORT)
+				__ULTATYPE_AGGREGATE_CASE(int, TYPE_INT)
+				__ULTATYPE_AGGREGATE_CASE(long, TYPE_LONG)
+				__ULTATYPE_AGGREGATE_CASE(long long, TYPE_LONGLONG)
+				__ULTATYPE_AGGREGATE_CASE(unsigned char, TYPE_UCHAR)
+				__ULTATYPE_AGGREGATE_CASE(unsigned short, TYPE_USHORT)
+				__ULTATYPE_AGGREGATE_CASE(unsigned int, TYPE_UINT)
+				__ULTATYPE_AGGREGATE_CASE(unsigned long, TYPE_ULONG)
+				__ULTATYPE_AGGREGATE_CASE(unsigned long long, TYPE_ULONGLONG)
+				__ULTATYPE_AGGREGATE_CASE(float, TYPE_FLOAT)
+				__ULTATYPE_AGGREGATE_CASE(double, TYPE_DOUBLE)
+				__ULTATYPE_AGGREGATE_CASE(long double, TYPE_LONGDOUBLE)
+#undef __ULTATYPE_AGGREGATE_CASE
+			default:
+				return nullptr;
+			}
+		}
+	} // namespace ULTAggregate
+
+	// Groups rows by key and keeps ULTAggregate::Aggregate_t of their values per group.
+	// Keys are equal as UltaHashMap keys are (5, 5L and 5.0 are one group), rows with empty key are skipped.
+	// Accumulator is picked once per run of values of one type. Groups are kept in order of first appearance.
+	class UltaAggregator final
+	{
+	public:
+		using Aggregate_t = ULTAggregate::Aggregate_t;
+		using Entry_t = UltaHashMap<Aggregate_t>::Entry_t;
+
+		inline void Add(const UltaTypeView& key, const UltaTypeView& value)
+		{
+			if (!key.GetTypeOps()) return;
+			Aggregate_t& aggregate = m_mGroups[key];
+			aggregate.ziCount++;
+			const ULTAggregate::Accumulator_t acc =
+				value.GetTypeOps() ? ULTAggregate::GetAccumulator((int)value.GetTypeIndex()) : nullptr;
+			if (acc) acc(aggregate, value.GetData());
+		}
+
+		// Rows are keys[i], values[i]. Throws std::invalid_argument if sizes differ.
+		inline void Add(const UltaColumn& keys, const UltaColumn& values)
+		{
+			if (keys.Size() != values.Size()) throw std::invalid_argument("UltaAggregator::Add");
+			AddRows(keys, values, 0, keys.Size());
+		}
+
+		template <typename KeyIt, typename ValueIt>
+		inline void Add(KeyIt firstKey, KeyIt lastKey, ValueIt firstValue)
+		{
+			AddRows(firstKey, firstValue, 0, (size_t)std::distance(firstKey, lastKey));
+		}
+
+		// Adds groups of other into this one, as if its rows were added here
+		inline void Merge(const UltaAggregator& other)
+		{
+			m_mGroups.Reserve(m_mGroups.Size() + other.m_mGroups.Size());
+			for (const Entry_t& entry : other.m_mGroups) m_mGroups[entry.first].Merge(entry.second);
+		}
+
+		inline size_t Size() const noexcept { return m_mGroups.Size(); }
+		inline bool Empty() const noexcept { return m_mGroups.Empty(); }
+		inline void Clear() noexcept { m_mGroups.Clear(); }
+		inline void Reserve(size_t groups) { m_mGroups.Reserve(groups); }
+
+		template <typename K>
+		inline const Aggregate_t* Find(const K& key) const
+		{
+			return m_mGroups.Find(key);
+		}
+
+		inline typename std::vector<Entry_t>::const_iterator begin() const noexcept { return m_mGroups.begin(); }
+		inline typename std::vector<Entry_t>::const_iterator end() const noexcept { return m_mGroups.end(); }
+
+		// keys[begin, end) and values[begin, end), indexing must give something UltaTypeView can be made of
+		template <typename K, typename V>
+		void AddRows(const K& keys, const V& values, size_t begin, size_t end)
+		{
+			const ULTReflection::TypeOps_t* ops = nullptr; // Value type of current run
+			ULTAggregate::Accumulator_t acc = nullptr;
+			for (size_t i = begin; i < end; i++)
+			{
+				const UltaTypeView key = keys[i];
+				if (!key.GetTypeOps()) continue;
+
+				const UltaTypeView value = values[i];
+				if (value.GetTypeOps() != ops)
+				{
+					ops = value.GetTypeOps();
+					acc = ops ? ULTAggregate::GetAccumulator((int)value.GetTypeIndex()) : nullptr;
+				}
+
+				Aggregate_t& aggregate = m_mGroups[key];
+				aggregate.ziCount++;
+				if (acc) acc(aggregate, value.GetData());
+			}
+		}
+
+	private:
+		UltaHashMap<Aggregate_t> m_mGroups;
+	};
+
+	// Aggregates rows on pool: every worker fills its own UltaAggregator from chunks of rows
+	// and those are merged at the end, so group order and floating sums may differ from run to run.
+	// nullptr pool aggregates on calling thread. Exception thrown by a worker is rethrown here.
+	// Throws std::invalid_argument if keys and values differ in size.
+	inline UltaAggregator Aggregate(const UltaColumn& keys, const UltaColumn& values,
+									ULTParallel::WorkerPool_t* pool = nullptr)
+	{
+		if (keys.Size() != values.Size()) throw std::invalid_argument("ULT::Aggregate");
+
+		UltaAggregator res;
+		if (!pool)
+		{
+			res.Add(keys, values);
+			return res;
+		}
+
+		const size_t n = keys.Size();
+		const size_t chunk = ULTATYPE_AGGREGATE_CHUNK_ROWS;
+		std::vector<UltaAggregator> partials(pool->GetWorkerCount());
+		std::vector<std::exception_ptr> errors(pool->GetWorkerCount());
+		pool->ParallelForWorker((n + chunk - 1) / chunk, [&](size_t c, size_t worker) {
+			if (errors[worker]) return;
+			try
+			{
+				partials[worker].AddRows(keys, values, c * chunk, std::min(n, (c + 1) * chunk));
+			}
+			catch (...)
+			{
+				errors[worker] = std::current_exception();
+			}
+		});
+
+		for (const std::exception_ptr& error : errors)
+			if (error) std::rethrow_exception(error);
+
+		for (UltaAggregator& partial : partials)
+		{
+			if (res.Empty())
+				res = std::move(partial);
+			else
+				res.Merge(partial);
+		}
+		return res;
+	}
+} // namespace ULT
+
+#endif
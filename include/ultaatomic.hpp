@@ -0,0 +1,639 @@
+/*
+============================================
+- File: ultaatomic.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: AtomicUltaType is UltaType
+  shared between threads without locks.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTAATOMIC_HPP
+#define ULTAATOMIC_HPP
+
+#include "ultatype.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#ifndef ULTATYPE_ATOMIC_RETIRE_THRESHOLD
+#define ULTATYPE_ATOMIC_RETIRE_THRESHOLD 64
+#endif
+
+// Hazard pointers per thread, that many operations can be nested (e.g. converter or comparer
+// called under one operation loads another AtomicUltaType)
+#ifndef ULTATYPE_ATOMIC_HAZARD_SLOTS
+#define ULTATYPE_ATOMIC_HAZARD_SLOTS 4
+#endif
+
+namespace ULT
+{
+	namespace ULTAtomic
+	{
+		// Boxed value, never changed after it's published
+		struct __ULTNode_t
+		{
+			UltaType value;
+			__ULTNode_t* pNext; // In retired list
+
+			inline explicit __ULTNode_t(const UltaTypeView& v) : value(v), pNext(nullptr) {}
+		};
+
+		// Hazard pointers of one thread. Records are never freed, record of exited thread is reused by a new one.
+		struct __ULTHazard_t
+		{
+			std::atomic<const void*> aPtrs[ULTATYPE_ATOMIC_HAZARD_SLOTS];
+			std::atomic<bool> aUsed{false};
+			__ULTHazard_t* pNext = nullptr;
+
+			inline __ULTHazard_t() noexcept
+			{
+				for (std::atomic<const void*>& ptr : aPtrs) ptr.store(nullptr, std::memory_order_relaxed);
+			}
+		};
+
+		struct __ULTHazardDomain_t
+		{
+			std::atomic<__ULTHazard_t*> aHazards{nullptr};
+			std::atomic<__ULTNode_t*> aOrphans{nullptr}; // Retired by exited threads and still protected then
+		};
+
+		inline __ULTHazardDomain_t& __ultGetHazardDomain() noexcept
+		{
+			static __ULTHazardDomain_t g_Domain;
+			return g_Domain;
+		}
+
+		// Hazard record and retired nodes of current thread
+		class __ULTThreadHazard_t final
+		{
+		public:
+			inline __ULTThreadHazard_t()
+				: m_pHazard(AcquireRecord()), m_pRetired(nullptr), m_ziRetired(0),
+				  m_ziNextScan(ULTATYPE_ATOMIC_RETIRE_THRESHOLD), m_ziDepth(0)
+			{
+			}
+			__ULTThreadHazard_t(const __ULTThreadHazard_t&) = delete;
+			__ULTThreadHazard_t& operator=(const __ULTThreadHazard_t&) = delete;
+
+			inline ~__ULTThreadHazard_t()
+			{
+				for (std::atomic<const void*>& ptr : m_pHazard->aPtrs) ptr.store(nullptr);
+				Scan();
+
+				__ULTHazardDomain_t& domain = __ultGetHazardDomain();
+				while (m_pRetired)
+				{
+					__ULTNode_t* node = m_pRetired;
+					m_pRetired = node->pNext;
+					node->pNext = domain.aOrphans.load(std::memory_order_relaxed);
+					while (!domain.aOrphans.compare_exchange_weak(node->pNext, node)) {}
+				}
+				m_pHazard->aUsed.store(false, std::memory_order_release);
+			}
+
+			// Slot for the next guard of this thread, guards are scoped so slots are released in reverse order
+			inline std::atomic<const void*>& AcquireSlot()
+			{
+				if (m_ziDepth == ULTATYPE_ATOMIC_HAZARD_SLOTS)
+					throw std::length_error("AtomicUltaType: operations nested too deep");
+				return m_pHazard->aPtrs[m_ziDepth++];
+			}
+
+			inline void ReleaseSlot() noexcept
+			{
+				m_pHazard->aPtrs[--m_ziDepth].store(nullptr, std::memory_order_release);
+			}
+
+			// Node was unlinked and is freed once no hazard points to it
+			inline void Retire(__ULTNode_t* node)
+			{
+				node->pNext = m_pRetired;
+				m_pRetired = node;
+				if (++m_ziRetired >= m_ziNextScan) Scan();
+			}
+
+		private:
+			static inline __ULTHazard_t* AcquireRecord()
+			{
+				__ULTHazardDomain_t& domain = __ultGetHazardDomain();
+				for (__ULTHazard_t* record = domain.aHazards.load(); record; record = record->pNext)
+				{
+					bool used = false;
+					if (record->aUsed.load(std::memory_order_relaxed)) continue;
+					if (record->aUsed.compare_exchange_strong(used, true)) return record;
+				}
+
+				__ULTHazard_t* record = new __ULTHazard_t();
+				record->aUsed.store(true, std::memory_order_relaxed);
+				record->pNext = domain.aHazards.load(std::memory_order_relaxed);
+				while (!domain.aHazards.compare_exchange_weak(record->pNext, record)) {}
+				return record;
+			}
+
+			// Frees retired nodes no thread points to, taking over nodes of exited threads first
+			inline void Scan()
+			{
+				__ULTHazardDomain_t& domain = __ultGetHazardDomain();
+				for (__ULTNode_t* orphan = domain.aOrphans.exchange(nullptr); orphan;)
+				{
+					__ULTNode_t* next = orphan->pNext;
+					orphan->pNext = m_pRetired;
+					m_pRetired = orphan;
+					orphan = next;
+				}
+
+				std::vector<const void*> hazards;
+				for (__ULTHazard_t* record = domain.aHazards.load(); record; record = record->pNext)
+					for (const std::atomic<const void*>& slot : record->aPtrs)
+					{
+						const void* ptr = slot.load();
+						if (ptr) hazards.push_back(ptr);
+					}
+				std::sort(hazards.begin(), hazards.end());
+
+				__ULTNode_t* kept = nullptr;
+				size_t keptCount = 0;
+				while (m_pRetired)
+				{
+					__ULTNode_t* node = m_pRetired;
+					m_pRetired = node->pNext;
+					if (std::binary_search(hazards.begin(), hazards.end(), (const void*)node))
+					{
+						node->pNext = kept;
+						kept = node;
+						keptCount++;
+					}
+					else
+						delete node;
+				}
+				m_pRetired = kept;
+				m_ziRetired = keptCount;
+				m_ziNextScan = keptCount + ULTATYPE_ATOMIC_RETIRE_THRESHOLD;
+			}
+
+		private:
+			__ULTHazard_t* m_pHazard;
+			__ULTNode_t* m_pRetired;
+			size_t m_ziRetired;
+			size_t m_ziNextScan; // Scans are amortized over at least threshold retires
+			size_t m_ziDepth;	 // Slots taken by live guards
+		};
+
+		inline __ULTThreadHazard_t& __ultGetThreadHazard()
+		{
+			static thread_local __ULTThreadHazard_t g_Thread;
+			return g_Thread;
+		}
+
+		// Word layout: 0 is empty, word ending with 01 holds number inline (bits 2..5 are BaseTypes_t, bits 8..63
+		// payload), word ending with 11 holds double with rotated exponent (see __ultEncodeDouble),
+		// other words point to __ULTNode_t
+		using Word_t = uint64_t;
+
+		inline bool IsInline(Word_t word) noexcept { return word & 1; }
+		inline bool IsBoxed(Word_t word) noexcept { return word && !(word & 1); }
+		inline bool IsRotatedDouble(Word_t word) noexcept { return (word & 3) == 3; }
+		inline int GetInlineType(Word_t word) noexcept
+		{
+			return IsRotatedDouble(word) ? (int)ULTReflection::BaseTypes_t::TYPE_DOUBLE : (int)((word >> 2) & 0xF);
+		}
+		inline __ULTNode_t* GetNode(Word_t word) noexcept { return (__ULTNode_t*)(uintptr_t)word; }
+
+		static_assert((int)ULTReflection::BaseTypes_t::TYPE_DOUBLE < 16, "Inline type must fit 4 bits");
+
+		template <typename T>
+		inline bool __ultFitsSigned(T value) noexcept
+		{
+			return (long long)value >= -((long long)1 << 55) && (long long)value < ((long long)1 << 55);
+		}
+
+		// Double with exponent bits 62..60 being 011 or 100 (2^-255 <= |x| < 2^257) keeps its value
+		// when bits 62 and 61 are dropped, since they follow from bit 60. That frees 2 bits for the tag.
+		inline bool __ultEncodeDouble(uint64_t bits, Word_t& word) noexcept
+		{
+			const uint64_t top = (bits >> 60) & 7;
+			if (top != 3 && top != 4) return false;
+			word = (bits & ((uint64_t)1 << 63)) | ((bits & (((uint64_t)1 << 61) - 1)) << 2) | 3;
+			return true;
+		}
+
+		inline uint64_t __ultDecodeDouble(Word_t word) noexcept
+		{
+			const uint64_t low = (word >> 2) & (((uint64_t)1 << 61) - 1);
+			const uint64_t bit60 = (low >> 60) & 1;
+			return (word & ((uint64_t)1 << 63)) | ((bit60 ^ 1) << 62) | (bit60 << 61) | low;
+		}
+
+		// Packs number into word if its payload fits 56 bits: integers of that range, any float,
+		// double of normal magnitude (see __ultEncodeDouble) or with low 8 bits of representation
+		// being 0 (zero, infinities, NaN, small integers...). Other numbers are boxed and allocate.
+		inline bool __ultEncodeInline(int typeIndex, const void* data, Word_t& word) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			const Word_t tag = ((Word_t)typeIndex << 2) | 1;
+			switch ((BaseTypes_t)typeIndex)
+			{
+			case BaseTypes_t::TYPE_CHAR:
+				word = ((Word_t)(long long)*(const char*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_SHORT:
+				word = ((Word_t)(long long)*(const short*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_INT:
+				word = ((Word_t)(long long)*(const int*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_LONG:
+				if (!__ultFitsSigned(*(const long*)data)) return false;
+				word = ((Word_t)(long long)*(const long*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_LONGLONG:
+				if (!__ultFitsSigned(*(const long long*)data)) return false;
+				word = ((Word_t)*(const long long*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_UCHAR:
+				word = ((Word_t)*(const unsigned char*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_USHORT:
+				word = ((Word_t)*(const unsigned short*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_UINT:
+				word = ((Word_t)*(const unsigned int*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_ULONG:
+				if ((unsigned long long)*(const unsigned long*)data >> 56) return false;
+				word = ((Word_t)*(const unsigned long*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_ULONGLONG:
+				if (*(const unsigned long long*)data >> 56) return false;
+				word = ((Word_t)*(const unsigned long long*)data << 8) | tag;
+				return true;
+			case BaseTypes_t::TYPE_FLOAT:
+			{
+				uint32_t bits;
+				memcpy(&bits, data, sizeof(bits));
+				word = ((Word_t)bits << 8) | tag;
+				return true;
+			}
+			case BaseTypes_t::TYPE_DOUBLE:
+			{
+				uint64_t bits;
+				memcpy(&bits, data, sizeof(bits));
+				if (__ultEncodeDouble(bits, word)) return true;
+				if (bits & 0xFF) return false;
+				word = bits | tag;
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		template <typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, T>::type
+		__ultDecodeInline(Word_t word) noexcept
+		{
+			return (T)((long long)word >> 8);
+		}
+
+		template <typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, T>::type
+		__ultDecodeInline(Word_t word) noexcept
+		{
+			return (T)(word >> 8);
+		}
+
+		template <typename T>
+		inline typename std::enable_if<std::is_same<T, float>::value, T>::type __ultDecodeInline(Word_t word) noexcept
+		{
+			const uint32_t bits = (uint32_t)(word >> 8);
+			float res;
+			memcpy(&res, &bits, sizeof(res));
+			return res;
+		}
+
+		template <typename T>
+		inline typename std::enable_if<std::is_same<T, double>::value, T>::type __ultDecodeInline(Word_t word) noexcept
+		{
+			const uint64_t bits = IsRotatedDouble(word) ? __ultDecodeDouble(word) : word & ~(uint64_t)0xFF;
+			double res;
+			memcpy(&res, &bits, sizeof(res));
+			return res;
+		}
+
+		inline void __ultDecodeInline(Word_t word, UltaType& out)
+		{
+			using ULTReflection::BaseTypes_t;
+			switch ((BaseTypes_t)GetInlineType(word))
+			{
+			case BaseTypes_t::TYPE_CHAR:
+				out = __ultDecodeInline<char>(word);
+				break;
+			case BaseTypes_t::TYPE_SHORT:
+				out = __ultDecodeInline<short>(word);
+				break;
+			case BaseTypes_t::TYPE_INT:
+				out = __ultDecodeInline<int>(word);
+				break;
+			case BaseTypes_t::TYPE_LONG:
+				out = __ultDecodeInline<long>(word);
+				break;
+			case BaseTypes_t::TYPE_LONGLONG:
+				out = __ultDecodeInline<long long>(word);
+				break;
+			case BaseTypes_t::TYPE_UCHAR:
+				out = __ultDecodeInline<unsigned char>(word);
+				break;
+			case BaseTypes_t::TYPE_USHORT:
+				out = __ultDecodeInline<unsigned short>(word);
+				break;
+			case BaseTypes_t::TYPE_UINT:
+				out = __ultDecodeInline<unsigned int>(word);
+				break;
+			case BaseTypes_t::TYPE_ULONG:
+				out = __ultDecodeInline<unsigned long>(word);
+				break;
+			case BaseTypes_t::TYPE_ULONGLONG:
+				out = __ultDecodeInline<unsigned long long>(word);
+				break;
+			case BaseTypes_t::TYPE_FLOAT:
+				out = __ultDecodeInline<float>(word);
+				break;
+			case BaseTypes_t::TYPE_DOUBLE:
+				out = __ultDecodeInline<double>(word);
+				break;
+			default:
+				out.Reset();
+				break;
+			}
+		}
+
+		// Keeps boxed node loaded from atomic alive until guard is gone. Takes its own hazard slot,
+		// so guards of nested operations don't drop protection of outer ones.
+		class __ULTHazardGuard_t final
+		{
+		public:
+			inline __ULTHazardGuard_t() : m_pThread(&__ultGetThreadHazard()), m_pSlot(&m_pThread->AcquireSlot()) {}
+			__ULTHazardGuard_t(const __ULTHazardGuard_t&) = delete;
+			__ULTHazardGuard_t& operator=(const __ULTHazardGuard_t&) = delete;
+			inline ~__ULTHazardGuard_t() { m_pThread->ReleaseSlot(); }
+
+			inline Word_t Protect(const std::atomic<Word_t>& atomic) noexcept
+			{
+				Word_t word = atomic.load();
+				for (;;)
+				{
+					if (!IsBoxed(word)) return word;
+					m_pSlot->store(GetNode(word));
+					const Word_t check = atomic.load();
+					if (check == word) return word;
+					word = check;
+				}
+			}
+
+		private:
+			__ULTThreadHazard_t* m_pThread;
+			std::atomic<const void*>* m_pSlot;
+		};
+	} // namespace ULTAtomic
+
+	// UltaType shared between threads. Every operation is lock-free (where 64 bit atomics are):
+	// numbers that fit one word (see ULTAtomic::__ultEncodeInline, covers almost every double) are kept inline
+	// and never allocate, other values are boxed in immutable nodes swapped by CAS, readers protect
+	// node they copy with hazard pointer, so they never block and never see type and payload torn apart.
+	// Like std::atomic it can't be copied. Boxed values are freed by the thread replacing them,
+	// so T must be destructible on any thread.
+	class AtomicUltaType final
+	{
+	private:
+		using Word_t = ULTAtomic::Word_t;
+
+		template <typename T>
+		using __ULTIsPlainValue_t =
+			std::integral_constant<bool, !std::is_same<T, UltaType>::value && !std::is_same<T, UltaTypeView>::value &&
+											 !std::is_array<T>::value>;
+
+	public:
+		inline AtomicUltaType() noexcept : m_aWord(0) {}
+		inline explicit AtomicUltaType(const UltaTypeView& value) : m_aWord(Encode(value)) {}
+		inline explicit AtomicUltaType(const UltaType& value) : m_aWord(Encode(UltaTypeView(value))) {}
+		template <typename T, typename = typename std::enable_if<__ULTIsPlainValue_t<T>::value>::type>
+		inline explicit AtomicUltaType(const T& value) : m_aWord(Encode(UltaTypeView::Of(value)))
+		{
+		}
+		// String literal is stored as std::string
+		template <typename T, typename std::enable_if<std::is_array<T>::value, int>::type = 0>
+		inline explicit AtomicUltaType(const T& value) : AtomicUltaType(UltaType(value))
+		{
+		}
+		AtomicUltaType(const AtomicUltaType&) = delete;
+		AtomicUltaType& operator=(const AtomicUltaType&) = delete;
+		inline ~AtomicUltaType() { Discard(m_aWord.load(std::memory_order_relaxed)); }
+
+		inline bool IsLockFree() const noexcept { return m_aWord.is_lock_free(); }
+
+		inline UltaType Load() const
+		{
+			UltaType res;
+			ULTAtomic::__ULTHazardGuard_t guard;
+			Decode(guard.Protect(m_aWord), res);
+			return res;
+		}
+
+		// Converts stored value into out, without creating UltaType when it's stored inline as T.
+		// Returns false and leaves out untouched if value is empty or can't be converted to T.
+		template <typename T>
+		inline bool TryLoad(T& out) const
+		{
+			ULTAtomic::__ULTHazardGuard_t guard;
+			return TryReadAs<T>(guard.Protect(m_aWord), out);
+		}
+
+		// Returns T() if value is empty or can't be converted to T
+		template <typename T>
+		inline T Load() const
+		{
+			T res = T();
+			if (!TryLoad<T>(res)) return T();
+			return res;
+		}
+
+		inline void Store(const UltaTypeView& value) { Release(m_aWord.exchange(Encode(value))); }
+		inline void Store(const UltaType& value) { Store(UltaTypeView(value)); }
+		template <typename T, typename = typename std::enable_if<__ULTIsPlainValue_t<T>::value>::type>
+		inline void Store(const T& value)
+		{
+			Store(UltaTypeView::Of(value));
+		}
+		template <typename T, typename std::enable_if<std::is_array<T>::value, int>::type = 0>
+		inline void Store(const T& value)
+		{
+			Store(UltaType(value));
+		}
+
+		inline UltaType Exchange(const UltaTypeView& value)
+		{
+			const Word_t old = m_aWord.exchange(Encode(value));
+			UltaType res;
+			Decode(old, res); // Unlinked node can't be freed by anyone else
+			Release(old);
+			return res;
+		}
+		inline UltaType Exchange(const UltaType& value) { return Exchange(UltaTypeView(value)); }
+
+		// Replaces value with desired if it's the same as expected, else loads it into expected.
+		// Numbers are the same if they have same type and representation (so NaN matches itself like in std::atomic),
+		// other values if they have same type and are equal by operator==.
+		inline bool CompareExchange(UltaType& expected, const UltaTypeView& desired)
+		{
+			const Word_t desiredWord = Encode(desired);
+			ULTAtomic::__ULTHazardGuard_t guard;
+			for (;;)
+			{
+				Word_t word = guard.Protect(m_aWord);
+				if (!Matches(word, expected))
+				{
+					Decode(word, expected);
+					Discard(desiredWord);
+					return false;
+				}
+				if (m_aWord.compare_exchange_strong(word, desiredWord))
+				{
+					Release(word);
+					return true;
+				}
+			}
+		}
+		inline bool CompareExchange(UltaType& expected, const UltaType& desired)
+		{
+			return CompareExchange(expected, UltaTypeView(desired));
+		}
+
+		// Adds n to stored value in its own type, like std::atomic::fetch_add, and returns previous value.
+		// Empty value is T(). Throws std::invalid_argument if there's no operator+ for stored type and T.
+		template <typename T>
+		inline UltaType FetchAdd(const T& n)
+		{
+			static_assert(std::is_arithmetic<T>::value, "FetchAdd needs arithmetic type");
+
+			const UltaType addend(n);
+			const UltaTypeView addendView(addend);
+			ULTAtomic::__ULTHazardGuard_t guard;
+			for (;;)
+			{
+				Word_t word = guard.Protect(m_aWord);
+				UltaType prev;
+				Decode(word, prev);
+				if (!word) prev = T();
+
+				const UltaTypeView prevView(prev);
+				if (!ULTOperations::FindOperators((int)prevView.GetTypeIndex(), prevView.GetTypeHash(),
+												 (int)addendView.GetTypeIndex(), addendView.GetTypeHash()))
+					throw std::invalid_argument("AtomicUltaType::FetchAdd");
+
+				UltaType next(prev);
+				next += addend;
+				const Word_t nextWord = Encode(UltaTypeView(next));
+				if (m_aWord.compare_exchange_weak(word, nextWord))
+				{
+					Release(word);
+					return prev;
+				}
+				Discard(nextWord);
+			}
+		}
+
+	private:
+		static inline Word_t Encode(const UltaTypeView& value)
+		{
+			if (!value.GetTypeOps()) return 0;
+
+			Word_t word;
+			if (ULTAtomic::__ultEncodeInline((int)value.GetTypeIndex(), value.GetData(), word)) return word;
+			return (Word_t)(uintptr_t) new ULTAtomic::__ULTNode_t(value);
+		}
+
+		// word must be protected or owned
+		static inline void Decode(Word_t word, UltaType& out)
+		{
+			if (ULTAtomic::IsInline(word))
+				ULTAtomic::__ultDecodeInline(word, out);
+			else if (word)
+				out = ULTAtomic::GetNode(word)->value;
+			else
+				out.Reset();
+		}
+
+		// word must be protected or owned
+		template <typename T>
+		static inline bool TryReadAs(Word_t word, T& out)
+		{
+			if (ReadInline(word, out,
+						   std::integral_constant<bool, std::is_integral<T>::value || std::is_same<T, float>::value ||
+															std::is_same<T, double>::value>()))
+				return true;
+			if (!word) return false;
+
+			UltaType value;
+			Decode(word, value);
+			return value.TryGetAs<T>(out);
+		}
+
+		template <typename T>
+		static inline bool ReadInline(Word_t, T&, std::false_type /*never inline*/) noexcept
+		{
+			return false;
+		}
+
+		template <typename T>
+		static inline bool ReadInline(Word_t word, T& out, std::true_type /*maybe inline*/) noexcept
+		{
+			if (!ULTAtomic::IsInline(word)) return false;
+			if (ULTAtomic::GetInlineType(word) != (int)ULTReflection::TypeIndex_t<T>::value) return false;
+			out = ULTAtomic::__ultDecodeInline<T>(word);
+			return true;
+		}
+
+		static inline bool Matches(Word_t word, const UltaType& expected)
+		{
+			const UltaTypeView view(expected);
+			if (!view.GetTypeOps()) return !word;
+
+			Word_t expectedWord;
+			if (ULTAtomic::__ultEncodeInline((int)view.GetTypeIndex(), view.GetData(), expectedWord))
+				return word == expectedWord;
+			if (!ULTAtomic::IsBoxed(word)) return false;
+
+			const UltaTypeView stored(ULTAtomic::GetNode(word)->value);
+			if (stored.GetTypeHash() != view.GetTypeHash()) return false;
+
+			using ULTReflection::BaseTypes_t;
+			const int index = (int)stored.GetTypeIndex();
+			if (ULTReflection::IsBaseType(index) && index != (int)BaseTypes_t::TYPE_LONGDOUBLE &&
+				index != (int)BaseTypes_t::TYPE_STDSTRING)
+				return memcmp(stored.GetData(), view.GetData(), stored.GetSize()) == 0;
+			return stored == view;
+		}
+
+		// Word was unlinked from atomic, node is freed when no reader holds it
+		static inline void Release(Word_t word)
+		{
+			if (ULTAtomic::IsBoxed(word)) ULTAtomic::__ultGetThreadHazard().Retire(ULTAtomic::GetNode(word));
+		}
+
+		// Word was never published
+		static inline void Discard(Word_t word) noexcept
+		{
+			if (ULTAtomic::IsBoxed(word)) delete ULTAtomic::GetNode(word);
+		}
+
+	private:
+		std::atomic<Word_t> m_aWord;
+	};
+} // namespace ULT
+
+#endif
@@ -0,0 +1,692 @@
+/*
+============================================
+- File: ultabinary.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Binary format for UltaType
+  values and views reading it in place.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTABINARY_HPP
+#define ULTABINARY_HPP
+
+#include "ultatype.hpp"
+
+// Record layout:
+//   tag      1 byte, 0 - empty, BaseTypes_t + 1 - base type, 0xFF - registered custom type
+//   id       varint, only for custom types, see ULT::RegisterSerializer
+//   length   varint, payload size in bytes
+//   payload  numbers are little endian (long double is copied as is, so it's readable only on same platform),
+//            strings are their chars without terminating zero, custom types are written by their serializer
+// Varints are unsigned LEB128. Tags of BaseTypes_t are part of the format, new base types must be appended.
+
+namespace ULT
+{
+	namespace ULTBinary
+	{
+		constexpr unsigned char g_ucEmptyTag = 0;
+		constexpr unsigned char g_ucCustomTag = 0xFF;
+		constexpr size_t g_ziMaxVarintLength = 10;
+
+		struct Serializer_t
+		{
+			const ULTReflection::TypeOps_t* pOps;
+			unsigned long long ullId;
+			size_t (*Size)(const void* obj);
+			void (*Write)(const void* obj, unsigned char* dst);
+			bool (*Read)(const unsigned char* src, size_t size, UltaType& out); // false if payload is malformed
+		};
+
+		// Serializers of custom types by type hash and by id.
+		// Shared by every translation unit and constructed on first use.
+		inline ULTReflection::TypePairRegistry_t<Serializer_t>& GetSerializers()
+		{
+			static ULTReflection::TypePairRegistry_t<Serializer_t> g_UTSerializers;
+			return g_UTSerializers;
+		}
+
+		inline ULTReflection::TypePairRegistry_t<Serializer_t>& GetSerializersById()
+		{
+			static ULTReflection::TypePairRegistry_t<Serializer_t> g_UTSerializersById;
+			return g_UTSerializersById;
+		}
+
+		inline size_t WriteVarint(unsigned long long value, unsigned char* dst) noexcept
+		{
+			size_t i = 0;
+			for (; value >= 0x80; value >>= 7) dst[i++] = (unsigned char)(value | 0x80);
+			dst[i++] = (unsigned char)value;
+			return i;
+		}
+
+		inline size_t GetVarintLength(unsigned long long value) noexcept
+		{
+			size_t len = 1;
+			for (; value >= 0x80; value >>= 7) len++;
+			return len;
+		}
+
+		// Advances src, returns false if varint is truncated, too long or doesn't fit in 64 bits
+		inline bool ReadVarint(const unsigned char*& src, const unsigned char* end, unsigned long long& value) noexcept
+		{
+			value = 0;
+			for (unsigned shift = 0; src < end && shift < 64; shift += 7)
+			{
+				const unsigned char byte = *src++;
+				if (shift == 63 && byte > 1) return false; // Only the top bit is left
+				value |= (unsigned long long)(byte & 0x7F) << shift;
+				if (!(byte & 0x80)) return true;
+			}
+			return false;
+		}
+
+		inline void __ultStoreLE(unsigned long long value, unsigned char* dst, size_t size) noexcept
+		{
+			for (size_t i = 0; i < size; i++) dst[i] = (unsigned char)(value >> (i * 8));
+		}
+
+		inline unsigned long long __ultLoadLE(const unsigned char* src, size_t size) noexcept
+		{
+			unsigned long long value = 0;
+			for (size_t i = 0; i < size; i++) value |= (unsigned long long)src[i] << (i * 8);
+			return value;
+		}
+
+		template <typename T>
+		inline void __ultWriteNumber(const void* obj, unsigned char* dst, std::true_type /*integral*/) noexcept
+		{
+			__ultStoreLE((unsigned long long)*(const T*)obj, dst, sizeof(T));
+		}
+
+		template <typename T>
+		inline void __ultWriteNumber(const void* obj, unsigned char* dst, std::false_type /*integral*/) noexcept
+		{
+			using Bits_t = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+			if (sizeof(T) != sizeof(Bits_t)) // long double
+			{
+				memcpy(dst, obj, sizeof(T));
+				return;
+			}
+			Bits_t bits;
+			memcpy(&bits, obj, sizeof(bits));
+			__ultStoreLE(bits, dst, sizeof(bits));
+		}
+
+		// Integers may be written with another width (long is 4 bytes on some platforms and 8 on others)
+		template <typename T>
+		inline T __ultReadNumber(const unsigned char* src, size_t size, std::true_type /*integral*/) noexcept
+		{
+			unsigned long long value = __ultLoadLE(src, size);
+			if (std::is_signed<T>::value && size < 8 && (src[size - 1] & 0x80)) value |= ~0ull << (size * 8);
+			return (T)value;
+		}
+
+		template <typename T>
+		inline T __ultReadNumber(const unsigned char* src, size_t, std::false_type /*integral*/) noexcept
+		{
+			using Bits_t = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+			T value;
+			if (sizeof(T) != sizeof(Bits_t))
+				memcpy(&value, src, sizeof(T));
+			else
+			{
+				const Bits_t bits = (Bits_t)__ultLoadLE(src, sizeof(Bits_t));
+				memcpy(&value, &bits, sizeof(T));
+			}
+			return value;
+		}
+
+		template <typename T>
+		inline T ReadNumber(const unsigned char* src, size_t size) noexcept
+		{
+			return __ultReadNumber<T>(src, size, std::is_integral<T>());
+		}
+
+		// Checks payload size of base type record
+		inline bool IsValidLength(int typeIndex, unsigned long long size) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			switch ((BaseTypes_t)typeIndex)
+			{
+			case BaseTypes_t::TYPE_FLOAT:
+				return size == sizeof(float);
+			case BaseTypes_t::TYPE_DOUBLE:
+				return size == sizeof(double);
+			case BaseTypes_t::TYPE_LONGDOUBLE:
+				return size == sizeof(long double);
+			case BaseTypes_t::TYPE_STDSTRING:
+				return true;
+			default:
+				return size >= 1 && size <= 8;
+			}
+		}
+
+		// Payload size of value, returns false if value can't be written
+		inline bool GetPayloadSize(const UltaTypeView& value, size_t& size, const Serializer_t*& serializer)
+		{
+			serializer = nullptr;
+			if (!value.GetTypeOps())
+				size = 0;
+			else if (value.GetTypeIndex() == ULTReflection::BaseTypes_t::TYPE_STDSTRING)
+				size = value.GetValueHard<std::string>().size();
+			else if (ULTReflection::IsBaseType((int)value.GetTypeIndex()))
+				size = value.GetSize();
+			else
+			{
+				serializer = GetSerializers().Find(value.GetTypeHash(), 0);
+				if (!serializer) return false;
+				size = serializer->Size(value.GetData());
+			}
+			return true;
+		}
+
+		// Bytes needed to write value, 0 if value has custom type without registered serializer
+		inline size_t GetEncodedSize(const UltaTypeView& value)
+		{
+			size_t size;
+			const Serializer_t* serializer;
+			if (!GetPayloadSize(value, size, serializer)) return 0;
+			return 1 + (serializer ? GetVarintLength(serializer->ullId) : 0) + GetVarintLength(size) + size;
+		}
+
+		// Writes value to dst, which must have GetEncodedSize(value) bytes. Returns written bytes count.
+		inline size_t Encode(const UltaTypeView& value, void* dst)
+		{
+			using ULTReflection::BaseTypes_t;
+			size_t size;
+			const Serializer_t* serializer;
+			if (!GetPayloadSize(value, size, serializer)) return 0;
+
+			unsigned char* p = (unsigned char*)dst;
+			if (!value.GetTypeOps())
+				*p++ = g_ucEmptyTag;
+			else if (serializer)
+			{
+				*p++ = g_ucCustomTag;
+				p += WriteVarint(serializer->ullId, p);
+			}
+			else
+				*p++ = (unsigned char)((int)value.GetTypeIndex() + 1);
+			p += WriteVarint(size, p);
+
+			switch (value.GetTypeIndex())
+			{
+#define __ULTATYPE_BINARY_WRITE_CASE(type, index)                                                                      \
+	case BaseTypes_t::index:                                                                                           \
+		__ultWriteNumber<type>(value.GetData(), p, std::is_integral<type>());                                          \
+		break;
+				__ULTATYPE_BINARY_WRITE_CASE(char, TYPE_CHAR)
+				__ULTATYPE_BINARY_WRITE_CASE(short, TYPE_SHORT)
+				__ULTATYPE_BINARY_WRITE_CASE(int, TYPE_INT)
+				__ULTATYPE_BINARY_WRITE_CASE(long, TYPE_LONG)
+				__ULTATYPE_BINARY_WRITE_CASE(long long, TYPE_LONGLONG)
+				__ULTATYPE_BINARY_WRITE_CASE(unsigned char, TYPE_UCHAR)
+				__ULTATYPE_BINARY_WRITE_CASE(unsigned short, TYPE_USHORT)
+				__ULTATYPE_BINARY_WRITE_CASE(unsigned int, TYPE_UINT)
+				__ULTATYPE_BINARY_WRITE_CASE(unsigned long, TYPE_ULONG)
+				__ULTATYPE_BINARY_WRITE_CASE(unsigned long long, TYPE_ULONGLONG)
+				__ULTATYPE_BINARY_WRITE_CASE(float, TYPE_FLOAT)
+				__ULTATYPE_BINARY_WRITE_CASE(double, TYPE_DOUBLE)
+				__ULTATYPE_BINARY_WRITE_CASE(long double, TYPE_LONGDOUBLE)
+#undef __ULTATYPE_BINARY_WRITE_CASE
+			case BaseTypes_t::TYPE_STDSTRING:
+				memcpy(p, value.GetValueHard<std::string>().data(), size);
+				break;
+			default:
+				if (serializer) serializer->Write(value.GetData(), p);
+				break;
+			}
+			return (size_t)(p - (unsigned char*)dst) + size;
+		}
+
+		// Appends value to out, returns false if it can't be written
+		inline bool Append(const UltaTypeView& value, std::vector<unsigned char>& out)
+		{
+			const size_t size = GetEncodedSize(value);
+			if (!size) return false;
+
+			const size_t offset = out.size();
+			out.resize(offset + size);
+			Encode(value, out.data() + offset);
+			return true;
+		}
+
+		template <typename T>
+		struct __ULTTrivialSerializer_t
+		{
+			static size_t Size(const void*) { return sizeof(T); }
+			static void Write(const void* obj, unsigned char* dst) { memcpy(dst, obj, sizeof(T)); }
+			static bool Read(const unsigned char* src, size_t size, UltaType& out)
+			{
+				if (size != sizeof(T)) return false;
+				T value;
+				memcpy(&value, src, sizeof(T));
+				out = value;
+				return true;
+			}
+		};
+	} // namespace ULTBinary
+
+	// id identifies T in written data, so it must be same in every program reading it
+	template <typename T>
+	inline void RegisterSerializer(unsigned long long id, size_t (*size)(const void* obj),
+								   void (*write)(const void* obj, unsigned char* dst),
+								   bool (*read)(const unsigned char* src, size_t size, UltaType& out))
+	{
+		static_assert(ULTReflection::TypeIndex_t<T>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN,
+					  "Serializers of base types are built in");
+		const ULTBinary::Serializer_t serializer = {ULTReflection::GetTypeOps<T>(), id, size, write, read};
+		ULTBinary::GetSerializers().Insert(typeid(T).hash_code(), 0, serializer);
+		ULTBinary::GetSerializersById().Insert((size_t)id, 0, serializer);
+	}
+
+	// Writes bytes of T as is
+	template <typename T>
+	inline void RegisterSerializer(unsigned long long id)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable, pass functions otherwise");
+		using S = ULTBinary::__ULTTrivialSerializer_t<T>;
+		RegisterSerializer<T>(id, S::Size, S::Write, S::Read);
+	}
+
+	// Read-only view of one record inside a buffer (memory mapped file, network packet...).
+	// Numbers and strings are read in place, nothing is copied or allocated unless value is converted to std::string
+	// or has custom type. Doesn't own anything, so it must not outlive the buffer.
+	class UltaBinaryView final
+	{
+	private:
+		template <typename T>
+		using __ULTIsValue_t =
+			std::integral_constant<bool, !std::is_same<T, UltaType>::value && !std::is_same<T, UltaTypeView>::value &&
+											 !std::is_same<T, UltaBinaryView>::value>;
+
+	public:
+		inline UltaBinaryView() noexcept
+			: m_pPayload(nullptr), m_ziSize(0), m_ziRecordSize(0), m_iTypeIndex(-1), m_pSerializer(nullptr),
+			  m_ullCustomId(0), m_bEmpty(true)
+		{
+		}
+
+		// Reads record from the start of data, check IsValid after
+		inline UltaBinaryView(const void* data, size_t size) noexcept : UltaBinaryView() { Parse(data, size); }
+
+		// False if record is truncated or malformed
+		inline bool IsValid() const noexcept { return m_ziRecordSize != 0; }
+		inline bool IsEmpty() const noexcept { return m_bEmpty; }
+
+		// Size of whole record, next record starts right after it
+		inline size_t GetRecordSize() const noexcept { return m_ziRecordSize; }
+
+		// Size of payload in bytes
+		inline size_t GetSize() const noexcept { return m_ziSize; }
+		inline const unsigned char* GetPayload() const noexcept { return m_pPayload; }
+
+		// TYPE_UNKNOWN for custom types
+		inline ULTReflection::BaseTypes_t GetTypeIndex() const noexcept
+		{
+			return (ULTReflection::BaseTypes_t)m_iTypeIndex;
+		}
+
+		// Id of custom type, serializer is nullptr if id isn't registered in this program
+		inline unsigned long long GetCustomId() const noexcept { return m_ullCustomId; }
+		inline const ULTBinary::Serializer_t* GetSerializer() const noexcept { return m_pSerializer; }
+
+		template <typename T>
+		inline bool IsSameType() const noexcept
+		{
+			return ULTReflection::TypeIndex_t<T>::value != ULTReflection::BaseTypes_t::TYPE_UNKNOWN
+					   ? m_iTypeIndex == (int)ULTReflection::TypeIndex_t<T>::value
+					   : m_pSerializer && m_pSerializer->pOps == ULTReflection::GetTypeOps<T>();
+		}
+
+		// Chars of std::string record
+		inline const char* GetChars() const noexcept { return (const char*)m_pPayload; }
+#if __cplusplus >= 201703L
+		inline std::string_view GetString() const noexcept { return std::string_view(GetChars(), m_ziSize); }
+#endif
+
+		// Calls fn with UltaTypeView of decoded value. Numbers are decoded on stack,
+		// strings and custom types are decoded into temporary objects.
+		template <typename F>
+		inline auto Visit(F&& fn) const -> decltype(fn(std::declval<const UltaTypeView&>()))
+		{
+			using ULTReflection::BaseTypes_t;
+			switch ((BaseTypes_t)m_iTypeIndex)
+			{
+#define __ULTATYPE_BINARY_VISIT_CASE(type, index)                                                                      \
+	case BaseTypes_t::index:                                                                                           \
+	{                                                                                                                  \
+		const type value = ULTBinary::ReadNumber<type>(m_pPayload, m_ziSize);                                          \
+		return fn(UltaTypeView::Of(value));                                                                            \
+	}
+				__ULTATYPE_BINARY_VISIT_CASE(char, TYPE_CHAR)
+				__ULTATYPE_BINARY_VISIT_CASE(short, TYPE_SHORT)
+				__ULTATYPE_BINARY_VISIT_CASE(int, TYPE_INT)
+				__ULTATYPE_BINARY_VISIT_CASE(long, TYPE_LONG)
+				__ULTATYPE_BINARY_VISIT_CASE(long long, TYPE_LONGLONG)
+				__ULTATYPE_BINARY_VISIT_CASE(unsigned char, TYPE_UCHAR)
+				__ULTATYPE_BINARY_VISIT_CASE(unsigned short, TYPE_USHORT)
+				__ULTATYPE_BINARY_VISIT_CASE(unsigned int, TYPE_UINT)
+				__ULTATYPE_BINARY_VISIT_CASE(unsigned long, TYPE_ULONG)
+				__ULTATYPE_BINARY_VISIT_CASE(unsigned long long, TYPE_ULONGLONG)
+				__ULTATYPE_BINARY_VISIT_CASE(float, TYPE_FLOAT)
+				__ULTATYPE_BINARY_VISIT_CASE(double, TYPE_DOUBLE)
+				__ULTATYPE_BINARY_VISIT_CASE(long double, TYPE_LONGDOUBLE)
+#undef __ULTATYPE_BINARY_VISIT_CASE
+			case BaseTypes_t::TYPE_STDSTRING:
+			{
+				const std::string value(GetChars(), m_ziSize);
+				return fn(UltaTypeView::Of(value));
+			}
+			default:
+			{
+				UltaType value;
+				if (m_pSerializer && !m_pSerializer->Read(m_pPayload, m_ziSize, value)) value.Reset();
+				return fn(UltaTypeView(value));
+			}
+			}
+		}
+
+		// Decoded copy of value
+		inline UltaType ToUltaType() const
+		{
+			return Visit([](const UltaTypeView& value) { return UltaType(value); });
+		}
+
+		// Returns T() if value can't be converted to T
+		template <typename T>
+		T GetValue() const
+		{
+			T res = T();
+			if (!TryGetAs<T>(res)) return T();
+			return res;
+		}
+
+		template <typename T>
+		bool TryGetAs(T& out) const
+		{
+			if (m_iTypeIndex == (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING && AssignString(out)) return true;
+			return Visit([&out](const UltaTypeView& value) { return value.TryGetAs<T>(out); });
+		}
+
+#if __cplusplus >= 201703L
+		template <typename T>
+		inline std::optional<T> As() const
+		{
+			std::optional<T> res(std::in_place);
+			if (!TryGetAs<T>(*res)) res.reset();
+			return res;
+		}
+#endif
+
+		inline bool operator==(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 0;
+		}
+
+		inline bool operator!=(const UltaTypeView& other) const { return !(*this == other); }
+
+		inline bool operator<(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == -1;
+		}
+
+		inline bool operator<=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == -1 || res == 0);
+		}
+
+		inline bool operator>(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 1;
+		}
+
+		inline bool operator>=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == 1 || res == 0);
+		}
+
+		inline bool operator==(const UltaType& other) const { return *this == UltaTypeView(other); }
+		inline bool operator!=(const UltaType& other) const { return !(*this == other); }
+		inline bool operator<(const UltaType& other) const { return *this < UltaTypeView(other); }
+		inline bool operator<=(const UltaType& other) const { return *this <= UltaTypeView(other); }
+		inline bool operator>(const UltaType& other) const { return *this > UltaTypeView(other); }
+		inline bool operator>=(const UltaType& other) const { return *this >= UltaTypeView(other); }
+
+		inline bool operator==(const UltaBinaryView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 0;
+		}
+
+		inline bool operator!=(const UltaBinaryView& other) const { return !(*this == other); }
+
+		inline bool operator<(const UltaBinaryView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == -1;
+		}
+
+		inline bool operator<=(const UltaBinaryView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == -1 || res == 0);
+		}
+
+		inline bool operator>(const UltaBinaryView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 1;
+		}
+
+		inline bool operator>=(const UltaBinaryView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == 1 || res == 0);
+		}
+
+		// Same results as comparing with UltaType holding other, numbers and strings are read in place
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator==(const T& other) const
+		{
+			char res;
+			return Compare(UltaTypeView::Of(other), res) && res == 0;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator!=(const T& other) const
+		{
+			return !(*this == other);
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator<(const T& other) const
+		{
+			char res;
+			return Compare(UltaTypeView::Of(other), res) && res == -1;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator<=(const T& other) const
+		{
+			char res;
+			return Compare(UltaTypeView::Of(other), res) && (res == -1 || res == 0);
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator>(const T& other) const
+		{
+			char res;
+			return Compare(UltaTypeView::Of(other), res) && res == 1;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator>=(const T& other) const
+		{
+			char res;
+			return Compare(UltaTypeView::Of(other), res) && (res == 1 || res == 0);
+		}
+
+	private:
+		inline void Parse(const void* data, size_t size) noexcept
+		{
+			const unsigned char* begin = (const unsigned char*)data;
+			const unsigned char* end = begin + size;
+			const unsigned char* p = begin;
+			if (p >= end) return;
+
+			const unsigned char tag = *p++;
+			int typeIndex = -1;
+			const ULTBinary::Serializer_t* serializer = nullptr;
+			unsigned long long customId = 0;
+			if (tag == ULTBinary::g_ucCustomTag)
+			{
+				if (!ULTBinary::ReadVarint(p, end, customId)) return;
+				serializer = ULTBinary::GetSerializersById().Find((size_t)customId, 0);
+			}
+			else if (tag != ULTBinary::g_ucEmptyTag)
+			{
+				typeIndex = tag - 1;
+				if (!ULTReflection::IsBaseType(typeIndex)) return;
+			}
+
+			unsigned long long length;
+			if (!ULTBinary::ReadVarint(p, end, length) || length > (unsigned long long)(end - p)) return;
+			if (typeIndex >= 0 && !ULTBinary::IsValidLength(typeIndex, length)) return;
+			if (tag == ULTBinary::g_ucEmptyTag && length) return;
+
+			m_pPayload = p;
+			m_ziSize = (size_t)length;
+			m_ziRecordSize = (size_t)(p - begin) + m_ziSize;
+			m_iTypeIndex = typeIndex;
+			m_pSerializer = serializer;
+			m_ullCustomId = customId;
+			m_bEmpty = tag == ULTBinary::g_ucEmptyTag;
+		}
+
+		static inline char CompareChars(const char* a, size_t aSize, const char* b, size_t bSize) noexcept
+		{
+			const int res = memcmp(a, b, aSize < bSize ? aSize : bSize);
+			if (res) return res < 0 ? -1 : 1;
+			return aSize < bSize ? -1 : (aSize == bSize ? 0 : 1);
+		}
+
+		static inline bool CompareViews(const UltaTypeView& a, const UltaTypeView& b, char& res)
+		{
+			const ULTCompare::Comparer_t comp = ULTCompare::FindComparer(
+				(int)a.GetTypeIndex(), a.GetTypeHash(), (int)b.GetTypeIndex(), b.GetTypeHash());
+			if (!comp) return false;
+			res = comp(a.GetData(), b.GetData());
+			return true;
+		}
+
+		// Strings are compared in place, there is no comparer between strings and other types anyway
+		inline bool Compare(const UltaTypeView& other, char& res) const
+		{
+			const bool otherIsString = other.GetTypeIndex() == ULTReflection::BaseTypes_t::TYPE_STDSTRING;
+			if (m_iTypeIndex == (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING || otherIsString)
+			{
+				if (m_iTypeIndex != (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING || !otherIsString) return false;
+				const std::string& str = other.GetValueHard<std::string>();
+				res = CompareChars(GetChars(), m_ziSize, str.data(), str.size());
+				return true;
+			}
+			return Visit([&](const UltaTypeView& value) { return CompareViews(value, other, res); });
+		}
+
+		inline bool Compare(const UltaBinaryView& other, char& res) const
+		{
+			const bool otherIsString = other.m_iTypeIndex == (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING;
+			if (m_iTypeIndex == (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING || otherIsString)
+			{
+				if (m_iTypeIndex != (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING || !otherIsString) return false;
+				res = CompareChars(GetChars(), m_ziSize, other.GetChars(), other.m_ziSize);
+				return true;
+			}
+			return other.Visit([&](const UltaTypeView& value) { return Compare(value, res); });
+		}
+
+		inline bool AssignString(std::string& out) const
+		{
+			out.assign(GetChars(), m_ziSize);
+			return true;
+		}
+
+		template <typename T>
+		inline bool AssignString(T& out) const
+		{
+			using IsNumber_t = std::integral_constant<bool, std::is_arithmetic<T>::value &&
+																ULTReflection::TypeIndex_t<T>::value !=
+																	ULTReflection::BaseTypes_t::TYPE_UNKNOWN>;
+			return AssignString(out, IsNumber_t());
+		}
+
+		// Parsed in place, malformed or out of range string gives T() like __ultFromStringConverter
+		template <typename T>
+		inline bool AssignString(T& out, std::true_type /*number*/) const noexcept
+		{
+			if (ULTConvert::FromChars(GetChars(), GetChars() + m_ziSize, out).ec != std::errc()) out = T();
+			return true;
+		}
+
+		template <typename T>
+		inline bool AssignString(T&, std::false_type /*number*/) const noexcept
+		{
+			return false;
+		}
+
+	private:
+		const unsigned char* m_pPayload;
+		size_t m_ziSize;
+		size_t m_ziRecordSize; // 0 if record isn't valid
+		int m_iTypeIndex;	   // ULTReflection::BaseTypes_t
+		const ULTBinary::Serializer_t* m_pSerializer;
+		unsigned long long m_ullCustomId;
+		bool m_bEmpty;
+	};
+
+	// Walks over records written one after another
+	class UltaBinaryReader final
+	{
+	public:
+		inline UltaBinaryReader(const void* data, size_t size) noexcept
+			: m_pData((const unsigned char*)data), m_ziSize(size), m_ziOffset(0), m_bError(false)
+		{
+		}
+
+		// Returns false at the end of data or on malformed record, see HasError
+		inline bool Next(UltaBinaryView& out) noexcept
+		{
+			if (m_bError || m_ziOffset >= m_ziSize) return false;
+
+			out = UltaBinaryView(m_pData + m_ziOffset, m_ziSize - m_ziOffset);
+			if (!out.IsValid())
+			{
+				m_bError = true;
+				return false;
+			}
+			m_ziOffset += out.GetRecordSize();
+			return true;
+		}
+
+		inline size_t GetOffset() const noexcept { return m_ziOffset; }
+		inline bool HasError() const noexcept { return m_bError; }
+
+	private:
+		const unsigned char* m_pData;
+		size_t m_ziSize;
+		size_t m_ziOffset;
+		bool m_bError;
+	};
+} // namespace ULT
+
+#endif
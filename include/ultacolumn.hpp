@@ -0,0 +1,414 @@
+/*
+============================================
+- File: ultacolumn.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaColumn is container for
+  storing many values with one type tag.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTACOLUMN_HPP
+#define ULTACOLUMN_HPP
+
+#include "ultatype.hpp"
+
+#include <cstdint>
+
+namespace ULT
+{
+	// While every pushed value has the same type, values are stored contiguously as a typed array
+	// with one type hash/size for the whole column. Pushing value of another type promotes column
+	// to mixed representation, which is an array of UltaType.
+	class UltaColumn final
+	{
+	public:
+		inline UltaColumn() noexcept
+			: m_pData(nullptr), m_ziSize(0), m_ziCapacity(0), m_pOps(nullptr), m_iTypeIndex(-1), m_bMixed(false)
+		{
+		}
+
+		inline UltaColumn(const UltaColumn& other) : UltaColumn() { Copy(other); }
+		inline UltaColumn(UltaColumn&& other) noexcept : UltaColumn() { Move(other); }
+		inline UltaColumn& operator=(const UltaColumn& other)
+		{
+			Copy(other);
+			return *this;
+		}
+		inline UltaColumn& operator=(UltaColumn&& other) noexcept
+		{
+			Move(other);
+			return *this;
+		}
+		inline ~UltaColumn() { Reset(); }
+
+		inline void Copy(const UltaColumn& other)
+		{
+			if (this == &other) return;
+
+			if (!m_bMixed && !other.m_bMixed && m_pOps && m_pOps == other.m_pOps && m_pOps->bTrivial &&
+				m_ziCapacity >= other.m_ziSize)
+			{
+				if (other.m_ziSize) memcpy(m_pData, other.m_pData, other.m_ziSize * m_pOps->ziSize);
+				m_ziSize = other.m_ziSize;
+				return;
+			}
+
+			Reset();
+			if (other.m_bMixed)
+			{
+				m_vMixed = other.m_vMixed;
+				m_bMixed = true;
+				return;
+			}
+
+			if (!other.m_pOps) return;
+			m_pOps = other.m_pOps;
+			m_iTypeIndex = other.m_iTypeIndex;
+			Reserve(other.m_ziSize);
+			for (size_t i = 0; i < other.m_ziSize; i++)
+				CopyElement(other.GetElement(i), GetElement(i));
+			m_ziSize = other.m_ziSize;
+		}
+
+		inline void Move(UltaColumn& other) noexcept
+		{
+			if (this == &other) return;
+
+			Reset();
+			m_pData = other.m_pData;
+			m_ziSize = other.m_ziSize;
+			m_ziCapacity = other.m_ziCapacity;
+			m_pOps = other.m_pOps;
+			m_iTypeIndex = other.m_iTypeIndex;
+			m_bMixed = other.m_bMixed;
+			m_vMixed = std::move(other.m_vMixed);
+
+			other.m_pData = nullptr;
+			other.m_ziSize = 0;
+			other.m_ziCapacity = 0;
+			other.m_pOps = nullptr;
+			other.m_iTypeIndex = -1;
+			other.m_bMixed = false;
+			other.m_vMixed.clear();
+		}
+
+		// Destroys every value, column forgets its type and becomes typed again
+		inline void Reset() noexcept
+		{
+			Clear();
+			::operator delete(m_pData);
+			m_pData = nullptr;
+			m_ziCapacity = 0;
+			m_pOps = nullptr;
+			m_iTypeIndex = -1;
+			std::vector<UltaType>().swap(m_vMixed);
+			m_bMixed = false;
+		}
+
+		// Destroys every value, but keeps column type and allocated memory
+		inline void Clear() noexcept
+		{
+			if (m_pOps && !m_pOps->bTrivial)
+				for (size_t i = 0; i < m_ziSize; i++)
+					m_pOps->Destroy(GetElement(i));
+			m_ziSize = 0;
+			m_vMixed.clear();
+		}
+
+		// Destroys values from index size on, does nothing if column has no more than size values
+		inline void Truncate(size_t size) noexcept
+		{
+			if (m_bMixed)
+			{
+				if (size < m_vMixed.size()) m_vMixed.erase(m_vMixed.begin() + (ptrdiff_t)size, m_vMixed.end());
+				return;
+			}
+
+			if (size >= m_ziSize) return;
+			if (m_pOps && !m_pOps->bTrivial)
+				for (size_t i = size; i < m_ziSize; i++)
+					m_pOps->Destroy(GetElement(i));
+			m_ziSize = size;
+		}
+
+		inline void Reserve(size_t capacity)
+		{
+			if (m_bMixed)
+				m_vMixed.reserve(capacity);
+			else if (m_pOps && capacity > m_ziCapacity)
+				Reallocate(capacity);
+		}
+
+		template <typename T, typename std::enable_if<!std::is_array<T>::value, int>::type = 0>
+		void Push(const T& value)
+		{
+			if (IsOwnElement(&value))
+			{
+				const T copy(value);
+				Push(copy);
+				return;
+			}
+
+			const ULTReflection::TypeOps_t* ops = ULTReflection::GetTypeOps<T>();
+			if (!m_bMixed && Adopt(ops, (int)ULTReflection::TypeIndex_t<T>::value))
+			{
+				new (GetElement(m_ziSize)) T(value);
+				m_ziSize++;
+				return;
+			}
+
+			Promote();
+			m_vMixed.emplace_back(value);
+		}
+
+		inline void Push(const UltaTypeView& value)
+		{
+			if (IsOwnElement(value.GetData()))
+			{
+				Push(UltaType(value));
+				return;
+			}
+
+			if (!m_bMixed && value.GetTypeOps() && Adopt(value.GetTypeOps(), (int)value.GetTypeIndex()))
+			{
+				CopyElement(value.GetData(), GetElement(m_ziSize));
+				m_ziSize++;
+				return;
+			}
+
+			Promote();
+			m_vMixed.emplace_back(value);
+		}
+
+		inline void Push(const UltaType& value) { Push(UltaTypeView(value)); }
+
+		// String literal is pushed as std::string
+		template <typename T, typename std::enable_if<std::is_array<T>::value, int>::type = 0>
+		inline void Push(const T& value)
+		{
+			Push(ULTReflection::__ultArrayString(value));
+		}
+
+		template <typename T>
+		void Set(size_t index, const T& value)
+		{
+			if (!m_bMixed && m_pOps == ULTReflection::GetTypeOps<T>())
+			{
+				*(T*)GetElement(index) = value;
+				return;
+			}
+
+			Promote();
+			m_vMixed[index] = value;
+		}
+
+		inline void Set(size_t index, const UltaTypeView& value)
+		{
+			if (!m_bMixed && m_pOps == value.GetTypeOps())
+			{
+				if (m_pOps->bTrivial)
+					memcpy(GetElement(index), value.GetData(), m_pOps->ziSize);
+				else
+					m_pOps->CopyAssign(value.GetData(), GetElement(index));
+				return;
+			}
+
+			Promote();
+			m_vMixed[index] = value;
+		}
+
+		inline void Set(size_t index, const UltaType& value) { Set(index, UltaTypeView(value)); }
+
+		inline UltaTypeView operator[](size_t index) const noexcept
+		{
+			if (m_bMixed) return UltaTypeView(m_vMixed[index]);
+			return UltaTypeView(m_pOps, m_iTypeIndex, GetElement(index));
+		}
+
+		// Typed array of values, nullptr if column is mixed or holds other type
+		template <typename T>
+		inline T* Data() noexcept
+		{
+			return !m_bMixed && m_pOps == ULTReflection::GetTypeOps<T>() ? (T*)m_pData : nullptr;
+		}
+
+		template <typename T>
+		inline const T* Data() const noexcept
+		{
+			return !m_bMixed && m_pOps == ULTReflection::GetTypeOps<T>() ? (const T*)m_pData : nullptr;
+		}
+
+		// Raw typed array, nullptr if column is mixed
+		inline void* RawData() noexcept { return m_bMixed ? nullptr : m_pData; }
+		inline const void* RawData() const noexcept { return m_bMixed ? nullptr : m_pData; }
+
+		// Values of mixed column, empty while column is typed
+		inline const std::vector<UltaType>& GetMixed() const noexcept { return m_vMixed; }
+
+		inline size_t Size() const noexcept { return m_bMixed ? m_vMixed.size() : m_ziSize; }
+
+		inline bool IsMixed() const noexcept { return m_bMixed; }
+
+		// Type of typed column, nullptr if column is mixed or nothing was pushed yet
+		inline const ULTReflection::TypeOps_t* GetTypeOps() const noexcept { return m_bMixed ? nullptr : m_pOps; }
+
+		inline ULTReflection::BaseTypes_t GetTypeIndex() const noexcept
+		{
+			return m_bMixed ? ULTReflection::BaseTypes_t::TYPE_UNKNOWN : (ULTReflection::BaseTypes_t)m_iTypeIndex;
+		}
+
+		inline size_t GetTypeHash() const noexcept
+		{
+			return !m_bMixed && m_pOps ? m_pOps->pTypeInfo->hash_code() : 0;
+		}
+
+		// Switches to array of UltaType. Does nothing if column is already mixed.
+		void Promote()
+		{
+			if (m_bMixed) return;
+
+			std::vector<UltaType> mixed;
+			mixed.reserve(m_ziSize + 1);
+			for (size_t i = 0; i < m_ziSize; i++)
+				mixed.emplace_back(UltaTypeView(m_pOps, m_iTypeIndex, GetElement(i)));
+
+			Reset();
+			m_vMixed = std::move(mixed);
+			m_bMixed = true;
+		}
+
+	private:
+		// Makes room for one more value of given type, false if column can't store it typed
+		inline bool Adopt(const ULTReflection::TypeOps_t* ops, int typeIndex)
+		{
+			if (!m_pOps)
+			{
+				if (ops->ziAlign > alignof(std::max_align_t)) return false;
+				m_pOps = ops;
+				m_iTypeIndex = typeIndex;
+			}
+			else if (m_pOps != ops)
+				return false;
+
+			if (m_ziSize == m_ziCapacity) Reallocate(m_ziCapacity ? m_ziCapacity * 2 : 8);
+			return true;
+		}
+
+		void Reallocate(size_t capacity)
+		{
+			void* data = ::operator new(capacity * m_pOps->ziSize);
+			if (m_pOps->bTrivial)
+			{
+				if (m_ziSize) memcpy(data, m_pData, m_ziSize * m_pOps->ziSize);
+			}
+			else
+			{
+				for (size_t i = 0; i < m_ziSize; i++)
+				{
+					m_pOps->MoveConstruct(GetElement(i), (char*)data + i * m_pOps->ziSize);
+					m_pOps->Destroy(GetElement(i));
+				}
+			}
+
+			::operator delete(m_pData);
+			m_pData = data;
+			m_ziCapacity = capacity;
+		}
+
+		inline void CopyElement(const void* src, void* dst)
+		{
+			if (m_pOps->bTrivial)
+				memcpy(dst, src, m_pOps->ziSize);
+			else
+				m_pOps->CopyConstruct(src, dst);
+		}
+
+		// Pushing value that lives inside of column must not read it after reallocation
+		inline bool IsOwnElement(const void* ptr) const noexcept
+		{
+			const uintptr_t begin = (uintptr_t)m_pData;
+			return !m_bMixed && m_pData && (uintptr_t)ptr >= begin &&
+				   (uintptr_t)ptr < begin + m_ziSize * m_pOps->ziSize;
+		}
+
+		inline void* GetElement(size_t index) const noexcept { return (char*)m_pData + index * m_pOps->ziSize; }
+
+	private:
+		void* m_pData;
+		size_t m_ziSize;
+		size_t m_ziCapacity;
+		const ULTReflection::TypeOps_t* m_pOps;
+		int m_iTypeIndex; // ULTReflection::BaseTypes_t
+		bool m_bMixed;
+		std::vector<UltaType> m_vMixed;
+	};
+
+	namespace ULTOperations
+	{
+		// result[i] = a[i] op b[i] for first min(a.Size(), b.Size()) values. Typed columns of BaseTypes_t
+		// go through batch kernel, anything else is computed per element like UltaType operators do.
+		inline void ApplyN(Operation_t op, const UltaColumn& a, const UltaColumn& b, UltaColumn& result)
+		{
+			if (&result == &b && &b != &a)
+			{
+				UltaColumn res;
+				ApplyN(op, a, b, res);
+				result = std::move(res);
+				return;
+			}
+
+			const size_t n = a.Size() < b.Size() ? a.Size() : b.Size();
+			const BatchOperatorFns_t* fns = a.GetTypeOps() && b.GetTypeOps()
+												? FindBatchOperators((int)a.GetTypeIndex(), (int)b.GetTypeIndex())
+												: nullptr;
+			if (fns)
+			{
+				result = a;
+				result.Truncate(n);
+				SelectBatchOperator(*fns, op)(result.RawData(), b.RawData(), result.RawData(), n);
+				return;
+			}
+
+			UltaColumn res;
+			res.Reserve(n);
+			OperatorCache_t cache;
+			for (size_t i = 0; i < n; i++)
+			{
+				const UltaTypeView aV = a[i];
+				const UltaTypeView bV = b[i];
+				UltaType value = aV;
+				const Operator_t fn =
+					cache.Get(op, (int)aV.GetTypeIndex(), aV.GetTypeHash(), (int)bV.GetTypeIndex(), bV.GetTypeHash());
+				if (fn) fn(value.GetPointer<void>(), bV.GetData(), value.GetPointer<void>());
+				res.Push(value);
+			}
+			result = std::move(res);
+		}
+	} // namespace ULTOperations
+
+	inline void PlusN(const UltaColumn& a, const UltaColumn& b, UltaColumn& result)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_PLUS, a, b, result);
+	}
+
+	inline void MinusN(const UltaColumn& a, const UltaColumn& b, UltaColumn& result)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_MINUS, a, b, result);
+	}
+
+	inline void MultiplyN(const UltaColumn& a, const UltaColumn& b, UltaColumn& result)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_MULTIPLY, a, b, result);
+	}
+
+	inline void DivideN(const UltaColumn& a, const UltaColumn& b, UltaColumn& result)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_DIVIDE, a, b, result);
+	}
+} // namespace ULT
+
+#endif
@@ -0,0 +1,519 @@
+/*
+============================================
+- File: ultacsv.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Streaming reader of delimited
+  text with type inference.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTACSV_HPP
+#define ULTACSV_HPP
+
+#include "ultacolumn.hpp"
+
+#include <algorithm>
+
+namespace ULT
+{
+	namespace ULTCsv
+	{
+		inline bool __ultIsSpace(char c) noexcept { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+		// Narrowest of int, long long and double holding the whole text (written to integer or real),
+		// TYPE_STDSTRING if text isn't a number and TYPE_UNKNOWN if it's empty.
+		// Whitespace around number is skipped on both sides.
+		inline ULTReflection::BaseTypes_t InferType(const char* first, const char* last, long long& integer,
+													double& real) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			if (first == last) return BaseTypes_t::TYPE_UNKNOWN;
+
+			const char c = *first;
+			if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || __ultIsSpace(c)))
+				return BaseTypes_t::TYPE_STDSTRING;
+
+			while (last != first && __ultIsSpace(last[-1])) --last;
+			if (first == last) return BaseTypes_t::TYPE_STDSTRING;
+
+			ULTConvert::FromCharsResult_t res = ULTConvert::FromChars(first, last, integer);
+			if (res.ec == std::errc() && res.ptr == last)
+			{
+				return integer >= std::numeric_limits<int>::min() && integer <= std::numeric_limits<int>::max()
+						   ? BaseTypes_t::TYPE_INT
+						   : BaseTypes_t::TYPE_LONGLONG;
+			}
+
+			res = ULTConvert::FromChars(first, last, real);
+			if (res.ec == std::errc() && res.ptr == last) return BaseTypes_t::TYPE_DOUBLE;
+			return BaseTypes_t::TYPE_STDSTRING;
+		}
+
+		struct Field_t
+		{
+			size_t ziRow; // Counted from 0, header isn't counted
+			size_t ziColumn;
+			UltaTypeView value; // Empty for empty unquoted field, valid only during callback
+			const char* pText;	// Unquoted text of field
+			size_t ziLength;
+		};
+	} // namespace ULTCsv
+
+	// Splits delimited text given in chunks of any size into fields and infers their types (see ULTCsv::InferType).
+	// Unquoted fields are parsed right from input, quoted ones and fields crossing chunk boundary are gathered
+	// into reused buffer, so numbers never allocate. Quotes inside quoted field are doubled (RFC 4180),
+	// rows end with \n, \r or \r\n, empty lines are skipped. Empty quoted field ("") is empty std::string,
+	// unlike empty unquoted one.
+	class UltaCsvReader final
+	{
+	private:
+		enum class State_t : int
+		{
+			STATE_FIELD_START,
+			STATE_UNQUOTED,
+			STATE_QUOTED,
+			STATE_QUOTE_IN_QUOTED,
+		};
+
+	public:
+		inline explicit UltaCsvReader(bool header = false, char delimiter = ',', char quote = '"')
+			: m_cDelimiter(delimiter), m_cQuote(quote), m_bHeader(header), m_eState(State_t::STATE_FIELD_START),
+			  m_bQuoted(false), m_ziRow(0), m_ziColumn(0), m_strString(std::string())
+		{
+		}
+
+		// Calls onField(const ULTCsv::Field_t&) for every field completed in this chunk
+		template <typename F>
+		void Feed(const char* data, size_t size, F&& onField)
+		{
+			const char* const end = data + size;
+			const char* p = data;
+			while (p != end)
+			{
+				switch (m_eState)
+				{
+				case State_t::STATE_FIELD_START:
+				{
+					const char c = *p;
+					if (c == '\n' || c == '\r')
+					{
+						if (m_ziColumn) // Row ended with delimiter
+						{
+							Emit(p, p, onField);
+							EndRow();
+						}
+						++p;
+					}
+					else if (c == m_cDelimiter)
+					{
+						Emit(p, p, onField);
+						m_ziColumn++;
+						++p;
+					}
+					else if (c == m_cQuote)
+					{
+						m_strField.clear();
+						m_bQuoted = true;
+						m_eState = State_t::STATE_QUOTED;
+						++p;
+					}
+					else
+					{
+						m_strField.clear();
+						m_eState = State_t::STATE_UNQUOTED;
+					}
+					break;
+				}
+				case State_t::STATE_UNQUOTED:
+				{
+					const char* it = p;
+					while (it != end && *it != m_cDelimiter && *it != '\n' && *it != '\r') ++it;
+					if (it == end)
+					{
+						m_strField.append(p, it);
+						p = it;
+						break;
+					}
+
+					if (m_strField.empty())
+						Emit(p, it, onField);
+					else
+					{
+						m_strField.append(p, it);
+						Emit(m_strField.data(), m_strField.data() + m_strField.size(), onField);
+					}
+					m_eState = State_t::STATE_FIELD_START;
+					if (*it == m_cDelimiter)
+						m_ziColumn++;
+					else
+						EndRow();
+					p = it + 1;
+					break;
+				}
+				case State_t::STATE_QUOTED:
+				{
+					const char* it = p;
+					while (it != end && *it != m_cQuote) ++it;
+					m_strField.append(p, it);
+					if (it != end) m_eState = State_t::STATE_QUOTE_IN_QUOTED;
+					p = it == end ? it : it + 1;
+					break;
+				}
+				case State_t::STATE_QUOTE_IN_QUOTED:
+				{
+					if (*p == m_cQuote)
+					{
+						m_strField.push_back(m_cQuote);
+						m_eState = State_t::STATE_QUOTED;
+						++p;
+					}
+					else
+						m_eState = State_t::STATE_UNQUOTED; // Rest of field up to delimiter is appended as is
+					break;
+				}
+				}
+			}
+		}
+
+		// Completes last row if input didn't end with line break
+		template <typename F>
+		void Finish(F&& onField)
+		{
+			if (m_eState != State_t::STATE_FIELD_START)
+				Emit(m_strField.data(), m_strField.data() + m_strField.size(), onField);
+			else if (m_ziColumn)
+				Emit(nullptr, nullptr, onField);
+
+			if (m_eState != State_t::STATE_FIELD_START || m_ziColumn) EndRow();
+			m_eState = State_t::STATE_FIELD_START;
+		}
+
+		// Names from the first row, if reader was created with header
+		inline const std::vector<std::string>& GetHeader() const noexcept { return m_vHeader; }
+
+		// Rows completed so far, without header
+		inline size_t GetRowCount() const noexcept { return m_ziRow; }
+
+	private:
+		template <typename F>
+		inline void Emit(const char* first, const char* last, F& onField)
+		{
+			const bool quoted = m_bQuoted;
+			m_bQuoted = false;
+			if (m_bHeader)
+			{
+				m_vHeader.emplace_back(first, last);
+				return;
+			}
+
+			using ULTReflection::BaseTypes_t;
+			long long integer;
+			double real;
+			UltaTypeView value;
+			int asInt;
+			switch (quoted && first == last ? BaseTypes_t::TYPE_STDSTRING
+											: ULTCsv::InferType(first, last, integer, real))
+			{
+			case BaseTypes_t::TYPE_INT:
+				asInt = (int)integer;
+				value = UltaTypeView::Of(asInt);
+				break;
+			case BaseTypes_t::TYPE_LONGLONG:
+				value = UltaTypeView::Of(integer);
+				break;
+			case BaseTypes_t::TYPE_DOUBLE:
+				value = UltaTypeView::Of(real);
+				break;
+			case BaseTypes_t::TYPE_STDSTRING:
+				m_strString.GetValueHard<std::string>().assign(first, last);
+				value = UltaTypeView(m_strString);
+				break;
+			default:
+				break;
+			}
+			onField(ULTCsv::Field_t{m_ziRow, m_ziColumn, value, first, (size_t)(last - first)});
+		}
+
+		inline void EndRow()
+		{
+			if (m_bHeader)
+				m_bHeader = false;
+			else
+				m_ziRow++;
+			m_ziColumn = 0;
+		}
+
+	private:
+		char m_cDelimiter;
+		char m_cQuote;
+		bool m_bHeader; // First row isn't read yet and is header
+		State_t m_eState;
+		bool m_bQuoted; // Current field started with quote
+		size_t m_ziRow;
+		size_t m_ziColumn;
+		std::string m_strField; // Quoted field or part of field from previous chunk
+		UltaType m_strString;	// Holds std::string, reused for string fields
+		std::vector<std::string> m_vHeader;
+	};
+
+	// Gathers fields into one typed column per CSV column. Column type is widened when value doesn't fit:
+	// int -> long long -> double -> std::string, values read before are converted. When column turns into
+	// strings, numbers read before get their original text back: text that doesn't match shortest form of
+	// stored number ("007", "1.50") is kept aside until then. Empty fields (and fields missing from short rows)
+	// keep column typed: they hold 0 or empty string and are marked in IsEmpty. Column that had nothing but
+	// empty fields so far holds empty values.
+	class UltaCsvColumns final
+	{
+	private:
+		// Original text of numbers that can't be rendered back from column, dropped once column holds strings
+		struct Texts_t
+		{
+			struct Entry_t
+			{
+				size_t ziRow;
+				size_t ziBegin; // In strChars
+				size_t ziLength;
+			};
+
+			std::vector<Entry_t> vEntries;
+			std::string strChars;
+
+			inline void Add(size_t row, const char* text, size_t length)
+			{
+				vEntries.push_back(Entry_t{row, strChars.size(), length});
+				strChars.append(text, length);
+			}
+		};
+
+	public:
+		inline void operator()(const ULTCsv::Field_t& field)
+		{
+			using ULTReflection::BaseTypes_t;
+			if (field.ziColumn >= m_vColumns.size())
+			{
+				m_vColumns.resize(field.ziColumn + 1);
+				m_vTypes.resize(field.ziColumn + 1, BaseTypes_t::TYPE_UNKNOWN);
+				m_vTexts.resize(field.ziColumn + 1);
+				m_vEmpty.resize(field.ziColumn + 1);
+			}
+
+			UltaColumn& column = m_vColumns[field.ziColumn];
+			BaseTypes_t& type = m_vTypes[field.ziColumn];
+			Texts_t& texts = m_vTexts[field.ziColumn];
+			std::vector<bool>& empty = m_vEmpty[field.ziColumn];
+			while (column.Size() < field.ziRow) PushEmpty(column, type, empty); // Row had less fields
+
+			if (!field.value.GetTypeOps())
+			{
+				PushEmpty(column, type, empty);
+				return;
+			}
+
+			const BaseTypes_t valueType = field.value.GetTypeIndex();
+			if (Rank(valueType) > Rank(type))
+			{
+				if (type != BaseTypes_t::TYPE_UNKNOWN)
+					Widen(column, texts, empty, valueType);
+				else if (column.Size())
+					Fill(column, valueType); // Nothing but empty fields so far
+				type = valueType;
+			}
+
+			const size_t row = column.Size();
+			empty.push_back(false);
+			switch (type)
+			{
+			case BaseTypes_t::TYPE_INT:
+				column.Push(field.value);
+				if (!IsCanonicalInteger(field.pText, field.ziLength)) texts.Add(row, field.pText, field.ziLength);
+				break;
+			case BaseTypes_t::TYPE_LONGLONG:
+				column.Push(field.value.GetValue<long long>());
+				if (!IsCanonicalInteger(field.pText, field.ziLength)) texts.Add(row, field.pText, field.ziLength);
+				break;
+			case BaseTypes_t::TYPE_DOUBLE:
+				column.Push(field.value.GetValue<double>());
+				if (!IsRendered(column[row], field.pText, field.ziLength)) texts.Add(row, field.pText, field.ziLength);
+				break;
+			default:
+				if (valueType == BaseTypes_t::TYPE_STDSTRING)
+					column.Push(field.value);
+				else
+					column.Push(std::string(field.pText, field.ziLength));
+				break;
+			}
+		}
+
+		inline std::vector<UltaColumn>& GetColumns() noexcept { return m_vColumns; }
+		inline const std::vector<UltaColumn>& GetColumns() const noexcept { return m_vColumns; }
+
+		// True if field was empty or missing, value in column is 0 or empty string then
+		inline bool IsEmpty(size_t column, size_t row) const noexcept
+		{
+			return column < m_vEmpty.size() && row < m_vEmpty[column].size() && m_vEmpty[column][row];
+		}
+
+	private:
+		// Value standing for empty field in column of type
+		static inline void PushPlaceholder(UltaColumn& column, ULTReflection::BaseTypes_t type)
+		{
+			using ULTReflection::BaseTypes_t;
+			switch (type)
+			{
+			case BaseTypes_t::TYPE_INT:
+				column.Push(0);
+				break;
+			case BaseTypes_t::TYPE_LONGLONG:
+				column.Push(0LL);
+				break;
+			case BaseTypes_t::TYPE_DOUBLE:
+				column.Push(0.0);
+				break;
+			case BaseTypes_t::TYPE_STDSTRING:
+				column.Push(std::string());
+				break;
+			default:
+				column.Push(UltaTypeView());
+				break;
+			}
+		}
+
+		static inline void PushEmpty(UltaColumn& column, ULTReflection::BaseTypes_t type, std::vector<bool>& empty)
+		{
+			PushPlaceholder(column, type);
+			empty.push_back(true);
+		}
+
+		// Column of empty values becomes column of placeholders of type
+		static inline void Fill(UltaColumn& column, ULTReflection::BaseTypes_t type)
+		{
+			const size_t size = column.Size();
+			column.Reset();
+			column.Reserve(size + 1);
+			for (size_t i = 0; i < size; i++) PushPlaceholder(column, type);
+		}
+
+		static inline int Rank(ULTReflection::BaseTypes_t type) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			switch (type)
+			{
+			case BaseTypes_t::TYPE_INT:
+				return 1;
+			case BaseTypes_t::TYPE_LONGLONG:
+				return 2;
+			case BaseTypes_t::TYPE_DOUBLE:
+				return 3;
+			case BaseTypes_t::TYPE_STDSTRING:
+				return 4;
+			default:
+				return 0;
+			}
+		}
+
+		// Optional '-' and digits without leading zeros, the only text integer is rendered back to
+		static inline bool IsCanonicalInteger(const char* text, size_t length) noexcept
+		{
+			if (!length || text[length - 1] < '0' || text[length - 1] > '9') return false;
+			const size_t start = text[0] == '-' ? 1 : 0;
+			if (start == length || text[start] < '0' || text[start] > '9') return false;
+			return text[start] != '0' || (length == 1);
+		}
+
+		// True if double is rendered back exactly to text
+		static inline bool IsRendered(const UltaTypeView& value, const char* text, size_t length) noexcept
+		{
+			char buffer[ULTConvert::g_ziMaxCharsLength];
+			const ULTConvert::ToCharsResult_t res =
+				ULTConvert::ToChars(buffer, buffer + sizeof(buffer), value.GetValueHard<double>());
+			return (size_t)(res.ptr - buffer) == length && memcmp(buffer, text, length) == 0;
+		}
+
+		template <typename T>
+		static inline void Convert(const UltaColumn& column, UltaColumn& res)
+		{
+			for (size_t i = 0; i < column.Size(); i++)
+			{
+				const UltaTypeView value = column[i];
+				if (value.GetTypeOps())
+					res.Push(value.GetValue<T>());
+				else
+					res.Push(value);
+			}
+		}
+
+		// Numbers whose text changes with conversion keep their text from before it
+		static inline void KeepChangedTexts(const UltaColumn& column, const UltaColumn& res, Texts_t& texts)
+		{
+			std::vector<bool> kept(column.Size(), false);
+			for (const Texts_t::Entry_t& entry : texts.vEntries) kept[entry.ziRow] = true;
+
+			char buffer[ULTConvert::g_ziMaxCharsLength];
+			for (size_t i = 0; i < column.Size(); i++)
+			{
+				const UltaTypeView value = column[i];
+				if (kept[i] || !value.GetTypeOps()) continue;
+
+				const ULTConvert::ToCharsResult_t text =
+					ULTConvert::ToChars(buffer, buffer + sizeof(buffer), value.GetValue<long long>());
+				if (!IsRendered(res[i], buffer, (size_t)(text.ptr - buffer)))
+					texts.Add(i, buffer, (size_t)(text.ptr - buffer));
+			}
+		}
+
+		static inline void ToStrings(const UltaColumn& column, Texts_t& texts, const std::vector<bool>& empty,
+									 UltaColumn& res)
+		{
+			std::sort(texts.vEntries.begin(), texts.vEntries.end(),
+					  [](const Texts_t::Entry_t& a, const Texts_t::Entry_t& b) { return a.ziRow < b.ziRow; });
+
+			size_t next = 0;
+			for (size_t i = 0; i < column.Size(); i++)
+			{
+				if (next < texts.vEntries.size() && texts.vEntries[next].ziRow == i)
+				{
+					const Texts_t::Entry_t& entry = texts.vEntries[next++];
+					res.Push(texts.strChars.substr(entry.ziBegin, entry.ziLength));
+					continue;
+				}
+
+				if (empty[i])
+					res.Push(std::string());
+				else
+					res.Push(column[i].GetValue<std::string>());
+			}
+
+			texts = Texts_t();
+		}
+
+		static inline void Widen(UltaColumn& column, Texts_t& texts, const std::vector<bool>& empty,
+								 ULTReflection::BaseTypes_t type)
+		{
+			using ULTReflection::BaseTypes_t;
+			UltaColumn res;
+			res.Reserve(column.Size() + 1);
+			if (type == BaseTypes_t::TYPE_LONGLONG)
+				Convert<long long>(column, res);
+			else if (type == BaseTypes_t::TYPE_DOUBLE)
+			{
+				Convert<double>(column, res);
+				if (!column.Data<double>()) KeepChangedTexts(column, res, texts);
+			}
+			else
+				ToStrings(column, texts, empty, res);
+			column = std::move(res);
+		}
+
+	private:
+		std::vector<UltaColumn> m_vColumns;
+		std::vector<ULTReflection::BaseTypes_t> m_vTypes; // Widest type seen in column
+		std::vector<Texts_t> m_vTexts;
+		std::vector<std::vector<bool>> m_vEmpty; // Per column, true for rows of empty fields
+	};
+} // namespace ULT
+
+#endif
@@ -0,0 +1,256 @@
+/*
+============================================
+- File: ultahashmap.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaHashMap is hash map
+  with UltaType keys.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTAHASHMAP_HPP
+#define ULTAHASHMAP_HPP
+
+#include "ultatype.hpp"
+
+#include <tuple>
+
+namespace ULT
+{
+	// Open addressing hash map keyed by UltaType. Keys are equal when UltaType::operator== says so,
+	// so 5, 5L and 5.0 are the same key. Lookup works with plain values (Find(5), Find("name"))
+	// without creating an UltaType. Keys of types outside of BaseTypes_t are found only with
+	// ULT::RegisterComparer<T, T>, and spread over buckets only with std::hash<T>.
+	// Entries are kept in insertion order until something is erased, Erase moves the last entry into the freed place.
+	// EraseOrdered keeps the order, but costs O(Size()).
+	template <typename V>
+	class UltaHashMap final
+	{
+	public:
+		using Entry_t = std::pair<UltaType, V>; // Key must not be changed through iteration
+
+	private:
+		struct Bucket_t
+		{
+			size_t ziHash;
+			size_t ziEntry; // g_ziEmpty if bucket is free
+		};
+
+		// Lookup key, either a value or chars of a string
+		struct Key_t
+		{
+			UltaTypeView view;
+			const char* pStr;
+			size_t ziLength;
+			size_t ziHash;
+		};
+
+		template <typename K>
+		using __ULTIsPlainKey_t = std::integral_constant<
+			bool, !std::is_same<K, UltaType>::value && !std::is_same<K, UltaTypeView>::value &&
+					  !std::is_same<K, std::string>::value &&
+#if __cplusplus >= 201703L
+					  !std::is_same<K, std::string_view>::value &&
+#endif
+					  !std::is_convertible<const K&, const char*>::value>;
+
+		static constexpr size_t g_ziEmpty = (size_t)-1;
+
+	public:
+		inline UltaHashMap() noexcept : m_ziMask(0) {}
+
+		inline size_t Size() const noexcept { return m_vEntries.size(); }
+		inline bool Empty() const noexcept { return m_vEntries.empty(); }
+
+		inline void Clear() noexcept
+		{
+			m_vEntries.clear();
+			for (Bucket_t& bucket : m_vBuckets) bucket.ziEntry = g_ziEmpty;
+		}
+
+		inline void Reserve(size_t count)
+		{
+			m_vEntries.reserve(count);
+			size_t capacity = m_vBuckets.empty() ? 16 : m_vBuckets.size();
+			while (count * 4 > capacity * 3) capacity *= 2;
+			if (capacity != m_vBuckets.size()) Rehash(capacity);
+		}
+
+		template <typename K>
+		inline V* Find(const K& key)
+		{
+			const size_t bucket = FindBucket(MakeKey(key));
+			return bucket != g_ziEmpty ? &m_vEntries[m_vBuckets[bucket].ziEntry].second : nullptr;
+		}
+
+		template <typename K>
+		inline const V* Find(const K& key) const
+		{
+			return const_cast<UltaHashMap*>(this)->Find(key);
+		}
+
+		template <typename K>
+		inline bool Contains(const K& key) const
+		{
+			return FindBucket(MakeKey(key)) != g_ziEmpty;
+		}
+
+		// Returns value stored by key and false if key was already there, value isn't replaced then
+		template <typename K, typename... Args>
+		inline std::pair<V*, bool> Emplace(const K& key, Args&&... args)
+		{
+			const Key_t k = MakeKey(key);
+			const size_t found = FindBucket(k);
+			if (found != g_ziEmpty) return {&m_vEntries[m_vBuckets[found].ziEntry].second, false};
+
+			if ((m_vEntries.size() + 1) * 4 > m_vBuckets.size() * 3)
+				Rehash(m_vBuckets.empty() ? 16 : m_vBuckets.size() * 2);
+
+			m_vEntries.emplace_back(std::piecewise_construct, std::forward_as_tuple(MakeOwned(k)),
+									std::forward_as_tuple(std::forward<Args>(args)...));
+			Place(k.ziHash, m_vEntries.size() - 1);
+			return {&m_vEntries.back().second, true};
+		}
+
+		template <typename K>
+		inline V& operator[](const K& key)
+		{
+			return *Emplace(key).first;
+		}
+
+		template <typename K>
+		inline bool Erase(const K& key)
+		{
+			const size_t bucket = FindBucket(MakeKey(key));
+			if (bucket == g_ziEmpty) return false;
+
+			const size_t entry = FreeBucket(bucket);
+			const size_t last = m_vEntries.size() - 1;
+			if (entry != last)
+			{
+				size_t moved = m_vEntries[last].first.GetHash() & m_ziMask;
+				while (m_vBuckets[moved].ziEntry != last) moved = (moved + 1) & m_ziMask;
+				m_vBuckets[moved].ziEntry = entry;
+				m_vEntries[entry] = std::move(m_vEntries[last]);
+			}
+			m_vEntries.pop_back();
+			return true;
+		}
+
+		// Same as Erase, but entries after erased one keep their order
+		template <typename K>
+		inline bool EraseOrdered(const K& key)
+		{
+			const size_t bucket = FindBucket(MakeKey(key));
+			if (bucket == g_ziEmpty) return false;
+
+			const size_t entry = FreeBucket(bucket);
+			m_vEntries.erase(m_vEntries.begin() + (ptrdiff_t)entry);
+			for (Bucket_t& b : m_vBuckets)
+				if (b.ziEntry != g_ziEmpty && b.ziEntry > entry) b.ziEntry--;
+			return true;
+		}
+
+		inline typename std::vector<Entry_t>::iterator begin() noexcept { return m_vEntries.begin(); }
+		inline typename std::vector<Entry_t>::iterator end() noexcept { return m_vEntries.end(); }
+		inline typename std::vector<Entry_t>::const_iterator begin() const noexcept { return m_vEntries.begin(); }
+		inline typename std::vector<Entry_t>::const_iterator end() const noexcept { return m_vEntries.end(); }
+
+	private:
+		static inline Key_t MakeKey(const UltaTypeView& key) noexcept { return {key, nullptr, 0, key.GetHash()}; }
+		static inline Key_t MakeKey(const UltaType& key) noexcept { return MakeKey(UltaTypeView(key)); }
+
+		static inline Key_t MakeKey(const char* key, size_t length) noexcept
+		{
+			return {UltaTypeView(), key, length, ULTReflection::HashBytes(key, length)};
+		}
+		static inline Key_t MakeKey(const char* key) noexcept { return MakeKey(key, strlen(key)); }
+		static inline Key_t MakeKey(const std::string& key) noexcept { return MakeKey(key.data(), key.size()); }
+#if __cplusplus >= 201703L
+		static inline Key_t MakeKey(std::string_view key) noexcept { return MakeKey(key.data(), key.size()); }
+#endif
+
+		template <typename K, typename = typename std::enable_if<__ULTIsPlainKey_t<K>::value>::type>
+		static inline Key_t MakeKey(const K& key) noexcept
+		{
+			return MakeKey(UltaTypeView::Of(key));
+		}
+
+		static inline UltaType MakeOwned(const Key_t& key)
+		{
+			if (key.pStr) return UltaType(std::string(key.pStr, key.ziLength));
+			return UltaType(key.view);
+		}
+
+		static inline bool Matches(const UltaType& stored, const Key_t& key)
+		{
+			if (!key.pStr) return stored == key.view;
+			if (!stored.IsSameType<std::string>()) return false;
+			const std::string& str = UltaTypeView(stored).GetValueHard<std::string>();
+			return str.size() == key.ziLength && memcmp(str.data(), key.pStr, key.ziLength) == 0;
+		}
+
+		inline size_t FindBucket(const Key_t& key) const
+		{
+			if (m_vBuckets.empty()) return g_ziEmpty;
+
+			for (size_t i = key.ziHash & m_ziMask;; i = (i + 1) & m_ziMask)
+			{
+				const Bucket_t& bucket = m_vBuckets[i];
+				if (bucket.ziEntry == g_ziEmpty) return g_ziEmpty;
+				if (bucket.ziHash == key.ziHash && Matches(m_vEntries[bucket.ziEntry].first, key)) return i;
+			}
+		}
+
+		// Frees bucket, returns index of its entry, which is left in place
+		inline size_t FreeBucket(size_t hole) noexcept
+		{
+			const size_t entry = m_vBuckets[hole].ziEntry;
+
+			// Backward shift, so lookups never need tombstones
+			for (size_t next = (hole + 1) & m_ziMask; m_vBuckets[next].ziEntry != g_ziEmpty;
+				 next = (next + 1) & m_ziMask)
+			{
+				const size_t home = m_vBuckets[next].ziHash & m_ziMask;
+				if (((next - home) & m_ziMask) >= ((next - hole) & m_ziMask))
+				{
+					m_vBuckets[hole] = m_vBuckets[next];
+					hole = next;
+				}
+			}
+			m_vBuckets[hole].ziEntry = g_ziEmpty;
+			return entry;
+		}
+
+		inline void Place(size_t hash, size_t entry) noexcept
+		{
+			size_t i = hash & m_ziMask;
+			while (m_vBuckets[i].ziEntry != g_ziEmpty) i = (i + 1) & m_ziMask;
+			m_vBuckets[i] = {hash, entry};
+		}
+
+		inline void Rehash(size_t capacity)
+		{
+			std::vector<Bucket_t> old(capacity, Bucket_t{0, g_ziEmpty});
+			old.swap(m_vBuckets);
+			m_ziMask = capacity - 1;
+			for (const Bucket_t& bucket : old)
+				if (bucket.ziEntry != g_ziEmpty) Place(bucket.ziHash, bucket.ziEntry);
+		}
+
+	private:
+		std::vector<Entry_t> m_vEntries;
+		std::vector<Bucket_t> m_vBuckets; // Size is always power of 2, at most 3/4 used
+		size_t m_ziMask;
+	};
+
+#if __cplusplus < 201703L
+	template <typename V>
+	constexpr size_t UltaHashMap<V>::g_ziEmpty;
+#endif
+} // namespace ULT
+
+#endif
@@ -0,0 +1,338 @@
+/*
+============================================
+- File: ultaobject.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaObject is record of
+  named UltaType fields.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTAOBJECT_HPP
+#define ULTAOBJECT_HPP
+
+#include "ultahashmap.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+
+// Objects with more fields switch to dictionary mode, so rare wide records don't create long shape chains
+#ifndef ULTATYPE_OBJECT_MAX_SHAPE_FIELDS
+#define ULTATYPE_OBJECT_MAX_SHAPE_FIELDS 64
+#endif
+
+namespace ULT
+{
+	namespace ULTObject
+	{
+		// Field names live as long as the program, equal names give the same pointer
+		inline const std::string* Intern(const char* name, size_t length)
+		{
+			static std::mutex g_Mutex;
+			static std::set<std::string> g_Names;
+
+			std::lock_guard<std::mutex> lock(g_Mutex);
+			return &*g_Names.emplace(name, length).first;
+		}
+
+		// Guards transitions of every shape
+		inline std::mutex& __ultShapeMutex()
+		{
+			static std::mutex g_Mutex;
+			return g_Mutex;
+		}
+
+		// Field set of objects in order fields were added, shared by every object built the same way.
+		// Shapes form a tree: adding a field moves object to child shape, which is created once and never freed.
+		// Shapes don't change after creation, so lookups need no locks.
+		class Shape_t final
+		{
+		private:
+			struct Entry_t
+			{
+				const std::string* pName; // nullptr if entry is free
+				size_t ziHash;
+				size_t ziSlot;
+			};
+
+		public:
+			static constexpr size_t g_ziNone = (size_t)-1;
+
+			// Shape without fields, every object starts from it
+			static inline const Shape_t* GetRoot()
+			{
+				static const Shape_t g_Root;
+				return &g_Root;
+			}
+
+			// Unique for every shape, never 0
+			inline uint32_t GetId() const noexcept { return m_uiId; }
+			inline size_t GetFieldCount() const noexcept { return m_vNames.size(); }
+			inline const std::string& GetFieldName(size_t slot) const noexcept { return *m_vNames[slot]; }
+
+			// Slot of field or g_ziNone
+			inline size_t Find(const std::string* name, size_t hash) const noexcept
+			{
+				for (size_t i = hash & m_ziMask;; i = (i + 1) & m_ziMask)
+				{
+					const Entry_t& entry = m_vTable[i];
+					if (entry.pName == name) return entry.ziSlot;
+					if (!entry.pName) return g_ziNone;
+				}
+			}
+
+			inline size_t Find(const char* name, size_t length, size_t hash) const noexcept
+			{
+				for (size_t i = hash & m_ziMask;; i = (i + 1) & m_ziMask)
+				{
+					const Entry_t& entry = m_vTable[i];
+					if (!entry.pName) return g_ziNone;
+					if (entry.ziHash == hash && entry.pName->size() == length &&
+						memcmp(entry.pName->data(), name, length) == 0)
+						return entry.ziSlot;
+				}
+			}
+
+			// Shape with one more field (name must be interned and not in this shape)
+			inline const Shape_t* Transition(const std::string* name, size_t hash) const
+			{
+				std::lock_guard<std::mutex> lock(__ultShapeMutex());
+				for (const std::pair<const std::string*, std::unique_ptr<Shape_t>>& child : m_vChildren)
+					if (child.first == name) return child.second.get();
+
+				m_vChildren.emplace_back(name, std::unique_ptr<Shape_t>(new Shape_t(*this, name, hash)));
+				return m_vChildren.back().second.get();
+			}
+
+		private:
+			inline Shape_t() : m_vTable(2, Entry_t{nullptr, 0, 0}), m_ziMask(1), m_uiId(NextId()) {}
+
+			inline Shape_t(const Shape_t& parent, const std::string* name, size_t hash)
+				: m_vNames(parent.m_vNames), m_uiId(NextId())
+			{
+				m_vNames.push_back(name);
+
+				size_t capacity = 2;
+				while (capacity < m_vNames.size() * 2) capacity *= 2; // At most half used
+				m_vTable.assign(capacity, Entry_t{nullptr, 0, 0});
+				m_ziMask = capacity - 1;
+
+				for (const Entry_t& entry : parent.m_vTable)
+					if (entry.pName) Place(entry);
+				Place(Entry_t{name, hash, m_vNames.size() - 1});
+			}
+
+			static inline uint32_t NextId() noexcept
+			{
+				static std::atomic<uint32_t> g_aLastId{0};
+				return g_aLastId.fetch_add(1, std::memory_order_relaxed) + 1;
+			}
+
+			inline void Place(const Entry_t& entry) noexcept
+			{
+				size_t i = entry.ziHash & m_ziMask;
+				while (m_vTable[i].pName) i = (i + 1) & m_ziMask;
+				m_vTable[i] = entry;
+			}
+
+		private:
+			std::vector<const std::string*> m_vNames; // By slot
+			std::vector<Entry_t> m_vTable;
+			size_t m_ziMask;
+			uint32_t m_uiId;
+			mutable std::vector<std::pair<const std::string*, std::unique_ptr<Shape_t>>> m_vChildren;
+		};
+
+#if __cplusplus < 201703L
+		constexpr size_t Shape_t::g_ziNone;
+#endif
+
+		// Precomputed field name for repeated access. Remembers slot for the last shape it met,
+		// so objects of the same shape are accessed by index. Shape id and slot are kept in one atomic word,
+		// so one Field_t can be used by several threads at once.
+		struct Field_t
+		{
+			inline Field_t(const char* name, size_t length)
+				: pName(Intern(name, length)), ziHash(ULTReflection::HashBytes(name, length)), aCache(0)
+			{
+			}
+			inline explicit Field_t(const char* name) : Field_t(name, strlen(name)) {}
+			inline explicit Field_t(const std::string& name) : Field_t(name.data(), name.size()) {}
+			inline Field_t(const Field_t& other) noexcept
+				: pName(other.pName), ziHash(other.ziHash), aCache(other.aCache.load(std::memory_order_relaxed))
+			{
+			}
+			inline Field_t& operator=(const Field_t& other) noexcept
+			{
+				pName = other.pName;
+				ziHash = other.ziHash;
+				aCache.store(other.aCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				return *this;
+			}
+
+			const std::string* pName;
+			size_t ziHash;
+			mutable std::atomic<uint64_t> aCache; // Shape id << 32 | slot, 0 if none
+		};
+	} // namespace ULTObject
+
+	// Record with named fields. Field values are kept in one array, positions of names are described by
+	// shape (ULTObject::Shape_t) shared with every object that got the same fields in the same order.
+	// Removing a field or adding more than ULTATYPE_OBJECT_MAX_SHAPE_FIELDS switches object to dictionary
+	// mode, where fields are kept in UltaHashMap. Fields are listed in order they were added.
+	class UltaObject final
+	{
+	public:
+		inline UltaObject() : m_pShape(ULTObject::Shape_t::GetRoot()) {}
+
+		// nullptr if there is no such field
+		inline UltaType* Find(const ULTObject::Field_t& field) noexcept
+		{
+			if (!m_pShape) return m_mDictionary.Find(*field.pName);
+
+			const uint64_t cache = field.aCache.load(std::memory_order_relaxed);
+			if ((uint32_t)(cache >> 32) == m_pShape->GetId()) return &m_vSlots[(uint32_t)cache];
+
+			const size_t slot = m_pShape->Find(field.pName, field.ziHash);
+			if (slot == ULTObject::Shape_t::g_ziNone) return nullptr;
+			field.aCache.store(((uint64_t)m_pShape->GetId() << 32) | slot, std::memory_order_relaxed);
+			return &m_vSlots[slot];
+		}
+
+		inline UltaType* Find(const char* name, size_t length)
+		{
+			if (!m_pShape) return m_mDictionary.Find(std::string(name, length));
+			const size_t slot = m_pShape->Find(name, length, ULTReflection::HashBytes(name, length));
+			return slot != ULTObject::Shape_t::g_ziNone ? &m_vSlots[slot] : nullptr;
+		}
+		inline UltaType* Find(const char* name) { return Find(name, strlen(name)); }
+		inline UltaType* Find(const std::string& name) { return Find(name.data(), name.size()); }
+
+		template <typename K>
+		inline const UltaType* Find(const K& name) const
+		{
+			return const_cast<UltaObject*>(this)->Find(name);
+		}
+
+		template <typename K>
+		inline bool Has(const K& name) const
+		{
+			return Find(name) != nullptr;
+		}
+
+		// Assigns field, adding it if object doesn't have it yet. value may refer to a field of this object.
+		template <typename T>
+		inline UltaType& Set(const ULTObject::Field_t& field, const T& value)
+		{
+			UltaType* slot = Find(field);
+			if (slot) return *slot = value;
+			return Add(field.pName, field.ziHash, UltaType(value)); // Copied first, adding may move fields
+		}
+
+		template <typename T>
+		inline UltaType& Set(const char* name, size_t length, const T& value)
+		{
+			UltaType* slot = Find(name, length);
+			if (slot) return *slot = value;
+			return Add(ULTObject::Intern(name, length), ULTReflection::HashBytes(name, length), UltaType(value));
+		}
+
+		template <typename T>
+		inline UltaType& Set(const char* name, const T& value)
+		{
+			return Set(name, strlen(name), value);
+		}
+
+		template <typename T>
+		inline UltaType& Set(const std::string& name, const T& value)
+		{
+			return Set(name.data(), name.size(), value);
+		}
+
+		// Field, added empty if object doesn't have it
+		template <typename K>
+		inline UltaType& operator[](const K& name)
+		{
+			UltaType* slot = Find(name);
+			return slot ? *slot : Set(name, UltaType());
+		}
+
+		// Switches object to dictionary mode, other fields keep their order
+		template <typename K>
+		inline bool Remove(const K& name)
+		{
+			if (!Find(name)) return false;
+			ToDictionary();
+			return m_mDictionary.EraseOrdered(GetName(name));
+		}
+
+		inline size_t Size() const noexcept { return m_pShape ? m_vSlots.size() : m_mDictionary.Size(); }
+		inline bool Empty() const noexcept { return Size() == 0; }
+
+		// Back to empty object with shared shape
+		inline void Clear() noexcept
+		{
+			m_vSlots.clear();
+			m_mDictionary.Clear();
+			m_pShape = ULTObject::Shape_t::GetRoot();
+		}
+
+		inline bool IsDictionary() const noexcept { return !m_pShape; }
+
+		// nullptr in dictionary mode
+		inline const ULTObject::Shape_t* GetShape() const noexcept { return m_pShape; }
+
+		// Calls fn(const std::string& name, const UltaType& value) for every field
+		template <typename F>
+		void ForEach(F&& fn) const
+		{
+			if (m_pShape)
+			{
+				for (size_t i = 0; i < m_vSlots.size(); i++) fn(m_pShape->GetFieldName(i), m_vSlots[i]);
+				return;
+			}
+			for (const UltaHashMap<UltaType>::Entry_t& entry : m_mDictionary)
+				fn(UltaTypeView(entry.first).GetValueHard<std::string>(), entry.second);
+		}
+
+	private:
+		static inline const std::string& GetName(const ULTObject::Field_t& field) noexcept { return *field.pName; }
+		static inline std::string GetName(const char* name) { return name; }
+		static inline const std::string& GetName(const std::string& name) noexcept { return name; }
+
+		// New field, name isn't in object yet
+		inline UltaType& Add(const std::string* name, size_t hash, UltaType&& value)
+		{
+			if (m_pShape && m_vSlots.size() >= ULTATYPE_OBJECT_MAX_SHAPE_FIELDS) ToDictionary();
+			if (!m_pShape) return *m_mDictionary.Emplace(*name, std::move(value)).first;
+
+			const ULTObject::Shape_t* shape = m_pShape->Transition(name, hash);
+			m_vSlots.emplace_back(std::move(value));
+			m_pShape = shape;
+			return m_vSlots.back();
+		}
+
+		inline void ToDictionary()
+		{
+			if (!m_pShape) return;
+			m_mDictionary.Reserve(m_vSlots.size() + 1);
+			for (size_t i = 0; i < m_vSlots.size(); i++)
+				m_mDictionary.Emplace(m_pShape->GetFieldName(i), std::move(m_vSlots[i]));
+			m_vSlots.clear();
+			m_pShape = nullptr;
+		}
+
+	private:
+		const ULTObject::Shape_t* m_pShape; // nullptr in dictionary mode
+		std::vector<UltaType> m_vSlots;		// By slot of shape
+		UltaHashMap<UltaType> m_mDictionary;
+	};
+} // namespace ULT
+
+#endif
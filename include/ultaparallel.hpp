@@ -0,0 +1,363 @@
+/*
+============================================
+- File: ultaparallel.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Worker pool and bulk
+  conversion of many values at once.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTAPARALLEL_HPP
+#define ULTAPARALLEL_HPP
+
+#include "ultacolumn.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Input and output bytes handled by one task of ULT::ConvertAll, keeps both in per core cache
+#ifndef ULTATYPE_PARALLEL_CHUNK_BYTES
+#define ULTATYPE_PARALLEL_CHUNK_BYTES 65536
+#endif
+
+namespace ULT
+{
+	namespace ULTParallel
+	{
+		// Fixed set of threads running index loops. Indices are split evenly between workers up front,
+		// worker that's done with its own part takes indices from the others' parts (work stealing),
+		// so uneven tasks still keep every worker busy. Calling thread works too.
+		class WorkerPool_t final
+		{
+		private:
+			// Padded to cache line, so workers taking indices don't slow each other down
+			struct Queue_t
+			{
+				std::atomic<size_t> aNext; // Next index to take, taken by owner and thieves alike
+				size_t ziEnd;
+				unsigned char aPad[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+			};
+
+		public:
+			// Pool of workers threads in total (including calling thread), 0 - one per hardware thread
+			inline explicit WorkerPool_t(size_t workers = 0)
+				: m_ziWorkers(workers ? workers : std::max<size_t>(1, std::thread::hardware_concurrency())),
+				  m_pQueues(new Queue_t[m_ziWorkers]), m_pfnRun(nullptr), m_pContext(nullptr), m_ziGeneration(0),
+				  m_aPending(0), m_bStop(false)
+			{
+				m_vThreads.reserve(m_ziWorkers - 1);
+				try
+				{
+					for (size_t i = 1; i < m_ziWorkers; i++)
+						m_vThreads.emplace_back(&WorkerPool_t::WorkerLoop, this, i);
+				}
+				catch (...)
+				{
+					Stop();
+					throw;
+				}
+			}
+			WorkerPool_t(const WorkerPool_t&) = delete;
+			WorkerPool_t& operator=(const WorkerPool_t&) = delete;
+			inline ~WorkerPool_t() { Stop(); }
+
+			inline size_t GetWorkerCount() const noexcept { return m_ziWorkers; }
+
+			// Calls fn(index) for every index in [0, count) and returns when all of them are done.
+			// fn must not throw. Loops of one pool run one after another.
+			template <typename F>
+			inline void ParallelFor(size_t count, F&& fn)
+			{
+				ParallelForWorker(count, [&fn](size_t index, size_t) { fn(index); });
+			}
+
+			// Same as ParallelFor, but calls fn(index, worker). Worker is in [0, GetWorkerCount())
+			// and runs one index at a time, so state kept per worker needs no locks.
+			template <typename F>
+			void ParallelForWorker(size_t count, F&& fn)
+			{
+				if (!count) return;
+
+				std::lock_guard<std::mutex> run(m_mRun);
+				if (m_ziWorkers == 1 || count == 1)
+				{
+					for (size_t i = 0; i < count; i++) fn(i, (size_t)0);
+					return;
+				}
+
+				for (size_t w = 0; w < m_ziWorkers; w++)
+				{
+					m_pQueues[w].aNext.store(count * w / m_ziWorkers, std::memory_order_relaxed);
+					m_pQueues[w].ziEnd = count * (w + 1) / m_ziWorkers;
+				}
+				m_pfnRun = &Invoke<typename std::remove_reference<F>::type>;
+				m_pContext = (void*)&fn;
+				{
+					std::lock_guard<std::mutex> lock(m_mLock);
+					m_aPending.store(m_ziWorkers - 1, std::memory_order_relaxed);
+					m_ziGeneration++;
+				}
+				m_cvWork.notify_all();
+
+				Work(0);
+
+				std::unique_lock<std::mutex> lock(m_mLock);
+				m_cvDone.wait(lock, [this] { return m_aPending.load(std::memory_order_acquire) == 0; });
+			}
+
+		private:
+			template <typename F>
+			static void Invoke(void* context, size_t index, size_t worker)
+			{
+				(*(F*)context)(index, worker);
+			}
+
+			// Own part first, then parts of other workers
+			inline void Work(size_t worker) noexcept
+			{
+				for (size_t k = 0; k < m_ziWorkers; k++)
+				{
+					Queue_t& queue = m_pQueues[(worker + k) % m_ziWorkers];
+					for (;;)
+					{
+						const size_t index = queue.aNext.fetch_add(1, std::memory_order_relaxed);
+						if (index >= queue.ziEnd) break;
+						m_pfnRun(m_pContext, index, worker);
+					}
+				}
+			}
+
+			inline void WorkerLoop(size_t worker)
+			{
+				size_t generation = 0;
+				for (;;)
+				{
+					{
+						std::unique_lock<std::mutex> lock(m_mLock);
+						m_cvWork.wait(lock, [&] { return m_bStop || m_ziGeneration != generation; });
+						if (m_bStop) return;
+						generation = m_ziGeneration;
+					}
+
+					Work(worker);
+
+					if (m_aPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						std::lock_guard<std::mutex> lock(m_mLock);
+						m_cvDone.notify_one();
+					}
+				}
+			}
+
+			inline void Stop() noexcept
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mLock);
+					m_bStop = true;
+				}
+				m_cvWork.notify_all();
+				for (std::thread& thread : m_vThreads) thread.join();
+				m_vThreads.clear();
+			}
+
+		private:
+			size_t m_ziWorkers;
+			std::unique_ptr<Queue_t[]> m_pQueues; // One per worker, index 0 is calling thread
+			std::vector<std::thread> m_vThreads;
+			void (*m_pfnRun)(void* context, size_t index, size_t worker);
+			void* m_pContext;
+			size_t m_ziGeneration; // Incremented by every ParallelFor, guarded by m_mLock
+			std::atomic<size_t> m_aPending; // Workers still running current loop
+			bool m_bStop;
+			std::mutex m_mRun;
+			std::mutex m_mLock;
+			std::condition_variable m_cvWork;
+			std::condition_variable m_cvDone;
+		};
+
+		// One bit per element, set if element wasn't converted
+		class FailureBitmap_t final
+		{
+		public:
+			inline FailureBitmap_t() noexcept : m_ziSize(0) {}
+
+			// Clears every bit
+			inline void Reset(size_t size)
+			{
+				m_vWords.assign((size + 63) / 64, 0);
+				m_ziSize = size;
+			}
+
+			inline size_t Size() const noexcept { return m_ziSize; }
+			inline bool Test(size_t index) const noexcept { return (m_vWords[index / 64] >> (index % 64)) & 1; }
+
+			// Not atomic, elements of one 64 bit word must be set by one thread
+			inline void Set(size_t index) noexcept { m_vWords[index / 64] |= (uint64_t)1 << (index % 64); }
+
+			inline size_t Count() const noexcept
+			{
+				size_t count = 0;
+				for (uint64_t word : m_vWords)
+					for (; word; word &= word - 1) count++;
+				return count;
+			}
+
+			inline const std::vector<uint64_t>& GetWords() const noexcept { return m_vWords; }
+
+		private:
+			std::vector<uint64_t> m_vWords;
+			size_t m_ziSize;
+		};
+
+		// How element type is turned into T, resolved once per run of elements of one type
+		enum class ConvertKind_t : int
+		{
+			CONVERT_NONE,
+			CONVERT_COPY,
+			CONVERT_PARSE, // std::string to number, malformed text is a failure
+			CONVERT_CONVERTER,
+		};
+
+		template <typename T>
+		inline ConvertKind_t __ultResolve(const UltaTypeView& value, ULTConvert::Converter_t& conv)
+		{
+			using ULTReflection::BaseTypes_t;
+			const size_t toHash = typeid(T).hash_code();
+			if (!value.GetTypeOps()) return ConvertKind_t::CONVERT_NONE;
+			if (value.GetTypeHash() == toHash) return ConvertKind_t::CONVERT_COPY;
+			if (value.GetTypeIndex() == BaseTypes_t::TYPE_STDSTRING && std::is_arithmetic<T>::value &&
+				!std::is_same<T, bool>::value)
+				return ConvertKind_t::CONVERT_PARSE;
+
+			conv = ULTConvert::FindConverter((int)value.GetTypeIndex(), value.GetTypeHash(),
+											 (int)ULTReflection::TypeIndex_t<T>::value, toHash);
+			return conv ? ConvertKind_t::CONVERT_CONVERTER : ConvertKind_t::CONVERT_NONE;
+		}
+
+		// Elements per task, multiple of 64 so every bitmap word belongs to one task
+		template <typename T, typename E>
+		constexpr size_t __ultChunkSize() noexcept
+		{
+			return ULTATYPE_PARALLEL_CHUNK_BYTES / (sizeof(E) + sizeof(T)) / 64 * 64 > 64
+					   ? ULTATYPE_PARALLEL_CHUNK_BYTES / (sizeof(E) + sizeof(T)) / 64 * 64
+					   : 64;
+		}
+
+		// Converts source[begin, end), source[i] must give something UltaTypeView can be made of.
+		// Throwing converter is a failure of its element, exception from source[i] leaves the range.
+		template <typename T, typename S>
+		void __ultConvertRange(const S& source, T* out, size_t begin, size_t end, FailureBitmap_t& failures)
+		{
+			using IsNumber_t = ULTConvert::__ULTIsNumber_t<T>;
+
+			const ULTReflection::TypeOps_t* ops = nullptr; // Type of current run, empty elements have none
+			ConvertKind_t kind = ConvertKind_t::CONVERT_NONE;
+			ULTConvert::Converter_t conv = nullptr;
+			for (size_t i = begin; i < end; i++)
+			{
+				const UltaTypeView value = source[i];
+				if (value.GetTypeOps() != ops)
+				{
+					ops = value.GetTypeOps();
+					kind = __ultResolve<T>(value, conv);
+				}
+
+				bool bConverted = false;
+				try
+				{
+					switch (kind)
+					{
+					case ConvertKind_t::CONVERT_COPY:
+						out[i] = *(const T*)value.GetData();
+						bConverted = true;
+						break;
+					case ConvertKind_t::CONVERT_PARSE:
+						bConverted = ULTConvert::__ultParse(value.GetData(), out[i], IsNumber_t());
+						break;
+					case ConvertKind_t::CONVERT_CONVERTER:
+						conv(value.GetData(), (void*)&out[i]);
+						bConverted = true;
+						break;
+					default:
+						break;
+					}
+				}
+				catch (...)
+				{
+				}
+				if (!bConverted) failures.Set(i);
+			}
+		}
+
+		template <typename T, typename S>
+		inline size_t __ultConvertAll(const S& source, size_t n, T* out, FailureBitmap_t& failures,
+									  WorkerPool_t* pool, size_t chunk)
+		{
+			failures.Reset(n);
+			const size_t chunks = (n + chunk - 1) / chunk;
+			if (!pool)
+			{
+				for (size_t c = 0; c < chunks; c++)
+					__ultConvertRange(source, out, c * chunk, std::min(n, (c + 1) * chunk), failures);
+				return failures.Count();
+			}
+
+			std::vector<std::exception_ptr> errors(pool->GetWorkerCount());
+			pool->ParallelForWorker(chunks, [&](size_t c, size_t worker) {
+				if (errors[worker]) return;
+				try
+				{
+					__ultConvertRange(source, out, c * chunk, std::min(n, (c + 1) * chunk), failures);
+				}
+				catch (...)
+				{
+					errors[worker] = std::current_exception();
+				}
+			});
+
+			for (const std::exception_ptr& error : errors)
+				if (error) std::rethrow_exception(error);
+			return failures.Count();
+		}
+	} // namespace ULTParallel
+
+	// out[i] = value of first[i] converted to T, out must have room for the whole range.
+	// Elements that can't be converted (empty, no converter, malformed number text, throwing converter)
+	// keep their out value and get their bit set in failures. Converter is resolved once per run of
+	// elements of one type. Work is split into cache sized chunks run by pool, nullptr runs on calling thread.
+	// It must be random access, first[i] is read from any worker. Exception thrown while reading
+	// an element is rethrown here once the loop is over. Returns number of failed elements.
+	template <typename T, typename It>
+	inline size_t ConvertAll(It first, It last, T* out, ULTParallel::FailureBitmap_t& failures,
+							 ULTParallel::WorkerPool_t* pool = nullptr)
+	{
+		static_assert(std::is_base_of<std::random_access_iterator_tag,
+									  typename std::iterator_traits<It>::iterator_category>::value,
+					  "ConvertAll needs random access iterator");
+		using Element_t = typename std::iterator_traits<It>::value_type;
+		return ULTParallel::__ultConvertAll(first, (size_t)std::distance(first, last), out, failures, pool,
+											ULTParallel::__ultChunkSize<T, Element_t>());
+	}
+
+	template <typename T>
+	inline size_t ConvertAll(const UltaColumn& column, T* out, ULTParallel::FailureBitmap_t& failures,
+							 ULTParallel::WorkerPool_t* pool = nullptr)
+	{
+		return ULTParallel::__ultConvertAll(column, column.Size(), out, failures, pool,
+											ULTParallel::__ultChunkSize<T, UltaTypeView>());
+	}
+} // namespace ULT
+
+#endif
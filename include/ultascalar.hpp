@@ -0,0 +1,475 @@
+/*
+============================================
+- File: ultascalar.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaScalar is compact value
+  for large arrays of numbers.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTASCALAR_HPP
+#define ULTASCALAR_HPP
+
+#include "ultatype.hpp"
+
+namespace ULT
+{
+	namespace ULTScalar
+	{
+		// Numeric BaseTypes_t that fit into 8 bytes are kept in UltaScalar itself
+		template <typename T>
+		using __ULTStoresInScalar_t =
+			std::integral_constant<bool, std::is_arithmetic<T>::value &&
+											 ULTReflection::TypeIndex_t<T>::value !=
+												 ULTReflection::BaseTypes_t::TYPE_UNKNOWN &&
+											 sizeof(T) <= 8>;
+
+		struct BaseType_t
+		{
+			const ULTReflection::TypeOps_t* pOps;
+			bool bInline; // see __ULTStoresInScalar_t
+		};
+
+		template <typename... Ts>
+		inline const BaseType_t& __ultGetBaseType(int index, ULTReflection::__ULTTypeList_t<Ts...>) noexcept
+		{
+			static const BaseType_t g_Types[] = {
+				{ULTReflection::GetTypeOps<Ts>(), __ULTStoresInScalar_t<Ts>::value}...};
+			return g_Types[index];
+		}
+
+		// index must be BaseTypes_t
+		inline const BaseType_t& GetBaseType(int index) noexcept
+		{
+			return __ultGetBaseType(index, ULTReflection::BaseTypesList_t());
+		}
+	} // namespace ULTScalar
+
+	// Value for arrays of hundreds of millions of mostly numeric values, 16 bytes instead of 64 of UltaType.
+	// Numeric BaseTypes_t up to 8 bytes are stored in place next to their BaseTypes_t tag, any other value
+	// (std::string, long double wider than 8 bytes, user types) is spilled to UltaType allocated on heap.
+	// Conversions, comparisons and hashes give the same results as UltaType holding the same value,
+	// between stored numbers they go straight to dense tables of ultatype.hpp without type hashes.
+	// Converts to UltaType and back, GetView gives UltaTypeView for UltaColumn, UltaHashMap and others.
+	class UltaScalar final : public ULTVariant::ClosedVariant_t
+	{
+	private:
+		static constexpr int g_iEmpty = (int)ULTReflection::BaseTypes_t::TYPE_UNKNOWN;
+		static constexpr int g_iSpilled = (int)ULTReflection::BaseTypes_t::TYPE_COUNT;
+
+		template <typename T>
+		using __ULTIsValue_t = std::integral_constant<bool, !std::is_same<T, UltaType>::value &&
+																!std::is_same<T, UltaTypeView>::value &&
+																!ULTVariant::__ULTIsClosedVariant_t<T>::value &&
+																!ULTExpression::__ULTIsExpression_t<T>::value>;
+
+	public:
+		inline UltaScalar() noexcept : m_uiBits(0), m_iTag(g_iEmpty) {}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline UltaScalar(const T& value) : m_uiBits(0), m_iTag(g_iEmpty)
+		{
+			Emplace(value, ULTScalar::__ULTStoresInScalar_t<T>());
+		}
+
+		inline UltaScalar(const UltaTypeView& view) : m_uiBits(0), m_iTag(g_iEmpty) { ConstructFrom(view); }
+		inline UltaScalar(const UltaType& value) : UltaScalar(UltaTypeView(value)) {}
+
+		inline UltaScalar(const UltaScalar& other) : m_uiBits(other.m_uiBits), m_iTag(other.m_iTag)
+		{
+			if (m_iTag == g_iSpilled) m_pSpill = new UltaType(*other.m_pSpill);
+		}
+
+		inline UltaScalar(UltaScalar&& other) noexcept : m_uiBits(other.m_uiBits), m_iTag(other.m_iTag)
+		{
+			other.m_iTag = g_iEmpty;
+		}
+
+		inline ~UltaScalar() { Reset(); }
+
+		inline UltaScalar& operator=(const UltaScalar& other)
+		{
+			if (this == &other) return *this;
+			if (other.m_iTag == g_iSpilled) return *this = *other.m_pSpill;
+
+			Reset();
+			m_uiBits = other.m_uiBits;
+			m_iTag = other.m_iTag;
+			return *this;
+		}
+
+		inline UltaScalar& operator=(UltaScalar&& other) noexcept
+		{
+			if (this == &other) return *this;
+			Reset();
+			m_uiBits = other.m_uiBits;
+			m_iTag = other.m_iTag;
+			other.m_iTag = g_iEmpty;
+			return *this;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline UltaScalar& operator=(const T& value)
+		{
+			Assign(value, ULTScalar::__ULTStoresInScalar_t<T>());
+			return *this;
+		}
+
+		inline UltaScalar& operator=(const UltaTypeView& view)
+		{
+			if (m_iTag == g_iSpilled && view.GetTypeOps() && !IsInline(view))
+			{
+				*m_pSpill = view; // Keeps allocation
+				return *this;
+			}
+
+			UltaScalar res(view);
+			return *this = std::move(res);
+		}
+
+		inline UltaScalar& operator=(const UltaType& value) { return *this = UltaTypeView(value); }
+
+		inline void Reset() noexcept
+		{
+			if (m_iTag == g_iSpilled) delete m_pSpill;
+			m_uiBits = 0;
+			m_iTag = g_iEmpty;
+		}
+
+		inline bool IsEmpty() const noexcept { return m_iTag == g_iEmpty; }
+
+		// Value lives on heap, see class description
+		inline bool IsSpilled() const noexcept { return m_iTag == g_iSpilled; }
+
+		inline ULTReflection::BaseTypes_t GetTypeIndex() const noexcept
+		{
+			return m_iTag == g_iSpilled ? m_pSpill->GetTypeIndex() : (ULTReflection::BaseTypes_t)m_iTag;
+		}
+
+		inline const ULTReflection::TypeOps_t* GetTypeOps() const noexcept
+		{
+			if (m_iTag == g_iSpilled) return UltaTypeView(*m_pSpill).GetTypeOps();
+			return m_iTag == g_iEmpty ? nullptr : ULTScalar::GetBaseType(m_iTag).pOps;
+		}
+
+		template <typename T>
+		inline bool IsSameType() const noexcept
+		{
+			if (m_iTag == g_iSpilled) return m_pSpill->IsSameType<T>();
+			return ULTScalar::__ULTStoresInScalar_t<T>::value && m_iTag == (int)ULTReflection::TypeIndex_t<T>::value;
+		}
+
+		// Stored value must be T
+		template <typename T>
+		inline const T& GetValueHard() const noexcept
+		{
+			if (m_iTag == g_iSpilled) return UltaTypeView(*m_pSpill).GetValueHard<T>();
+			return *reinterpret_cast<const T*>(m_aData);
+		}
+
+		// Converts stored value directly into out. Returns false and leaves out untouched
+		// if stored type can't be converted to T.
+		template <typename T>
+		inline bool TryGetAs(T& out) const
+		{
+			const int toIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+			if (m_iTag == g_iEmpty || m_iTag == g_iSpilled || !ULTReflection::IsBaseType(toIndex))
+				return GetView().TryGetAs(out);
+
+			if (m_iTag == toIndex)
+			{
+				out = GetValueHard<T>();
+				return true;
+			}
+
+			const ULTConvert::Converter_t conv = ULTConvert::FindConverter(m_iTag, 0, toIndex, 0);
+			if (!conv) return false;
+			return ULTConvert::__ultTryConvert(conv, m_iTag, m_aData, out);
+		}
+
+		// Unlike UltaType::GetValue returns copy, T() if stored type can't be converted
+		template <typename T>
+		inline T GetValue() const
+		{
+			T res = T();
+			TryGetAs(res);
+			return res;
+		}
+
+#if __cplusplus >= 201703L
+		template <typename T>
+		inline std::optional<T> As() const
+		{
+			std::optional<T> res(std::in_place);
+			if (!TryGetAs<T>(*res)) res.reset();
+			return res;
+		}
+#endif
+
+		// Returns false if stored value isn't number
+		inline bool ReadNumber(ULTReflection::Number_t& out) const noexcept
+		{
+			if (m_iTag == g_iSpilled)
+				return ULTReflection::ReadNumber((int)m_pSpill->GetTypeIndex(), UltaTypeView(*m_pSpill).GetData(), out);
+			return ULTReflection::ReadNumber(m_iTag, m_aData, out);
+		}
+
+		// Refers to this UltaScalar, so it's valid until value is changed
+		inline UltaTypeView GetView() const noexcept
+		{
+			if (m_iTag == g_iSpilled) return UltaTypeView(*m_pSpill);
+			if (m_iTag == g_iEmpty) return UltaTypeView();
+			return UltaTypeView(ULTScalar::GetBaseType(m_iTag).pOps, m_iTag, m_aData);
+		}
+
+		// Same as UltaType::GetHash of equal value
+		inline size_t GetHash() const noexcept
+		{
+			ULTReflection::Number_t number;
+			if (m_iTag != g_iSpilled && ULTReflection::ReadNumber(m_iTag, m_aData, number))
+				return ULTReflection::HashNumber(number);
+			return GetView().GetHash();
+		}
+
+		inline operator UltaType() const { return m_iTag == g_iSpilled ? *m_pSpill : UltaType(GetView()); }
+
+		inline bool operator==(const UltaScalar& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 0;
+		}
+
+		inline bool operator!=(const UltaScalar& other) const { return !(*this == other); }
+
+		inline bool operator<(const UltaScalar& other) const
+		{
+			char res;
+			return Compare(other, res) && res == -1;
+		}
+
+		inline bool operator<=(const UltaScalar& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == -1 || res == 0);
+		}
+
+		inline bool operator>(const UltaScalar& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 1;
+		}
+
+		inline bool operator>=(const UltaScalar& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == 1 || res == 0);
+		}
+
+		inline bool operator==(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 0;
+		}
+
+		inline bool operator!=(const UltaTypeView& other) const { return !(*this == other); }
+
+		inline bool operator<(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == -1;
+		}
+
+		inline bool operator<=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == -1 || res == 0);
+		}
+
+		inline bool operator>(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 1;
+		}
+
+		inline bool operator>=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == 1 || res == 0);
+		}
+
+		inline bool operator==(const UltaType& other) const { return *this == UltaTypeView(other); }
+		inline bool operator!=(const UltaType& other) const { return !(*this == UltaTypeView(other)); }
+		inline bool operator<(const UltaType& other) const { return *this < UltaTypeView(other); }
+		inline bool operator<=(const UltaType& other) const { return *this <= UltaTypeView(other); }
+		inline bool operator>(const UltaType& other) const { return *this > UltaTypeView(other); }
+		inline bool operator>=(const UltaType& other) const { return *this >= UltaTypeView(other); }
+
+		// Same results as comparing with UltaScalar holding other
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator==(const T& other) const
+		{
+			char res;
+			return CompareTo(other, res) && res == 0;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator!=(const T& other) const
+		{
+			return !(*this == other);
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator<(const T& other) const
+		{
+			char res;
+			return CompareTo(other, res) && res == -1;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator<=(const T& other) const
+		{
+			char res;
+			return CompareTo(other, res) && (res == -1 || res == 0);
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator>(const T& other) const
+		{
+			char res;
+			return CompareTo(other, res) && res == 1;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool operator>=(const T& other) const
+		{
+			char res;
+			return CompareTo(other, res) && (res == 1 || res == 0);
+		}
+
+		// Returns false if values can't be compared, res is -1, 0 or 1 otherwise
+		inline bool Compare(const UltaScalar& other, char& res) const
+		{
+			if (!IsStoredNumber() || !other.IsStoredNumber()) return Compare(other.GetView(), res);
+
+			const ULTCompare::Comparer_t comp = ULTCompare::FindComparer(m_iTag, 0, other.m_iTag, 0);
+			if (!comp) return false;
+			res = comp(m_aData, other.m_aData);
+			return true;
+		}
+
+		inline bool Compare(const UltaTypeView& other, char& res) const
+		{
+			const int index = (int)other.GetTypeIndex();
+			if (!IsStoredNumber() || !ULTReflection::IsBaseType(index)) return CompareViews(GetView(), other, res);
+
+			const ULTCompare::Comparer_t comp = ULTCompare::FindComparer(m_iTag, 0, index, 0);
+			if (!comp) return false;
+			res = comp(m_aData, other.GetData());
+			return true;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsValue_t<T>::value>::type>
+		inline bool CompareTo(const T& other, char& res) const
+		{
+			const int index = (int)ULTReflection::TypeIndex_t<T>::value;
+			if (!IsStoredNumber() || !ULTReflection::IsBaseType(index))
+				return CompareViews(GetView(), UltaTypeView::Of(other), res);
+
+			const ULTCompare::Comparer_t comp = ULTCompare::FindComparer(m_iTag, 0, index, 0);
+			if (!comp) return false;
+			res = comp(m_aData, &other);
+			return true;
+		}
+
+	private:
+		// Same as UltaTypeView comparison operators do
+		static inline bool CompareViews(const UltaTypeView& a, const UltaTypeView& b, char& res)
+		{
+			const ULTCompare::Comparer_t comp = ULTCompare::FindComparer((int)a.GetTypeIndex(), a.GetTypeHash(),
+																		 (int)b.GetTypeIndex(), b.GetTypeHash());
+			if (!comp) return false;
+			res = comp(a.GetData(), b.GetData());
+			return true;
+		}
+
+		inline bool IsStoredNumber() const noexcept { return m_iTag != g_iEmpty && m_iTag != g_iSpilled; }
+
+		static inline bool IsInline(const UltaTypeView& view) noexcept
+		{
+			const int index = (int)view.GetTypeIndex();
+			return ULTReflection::IsBaseType(index) && ULTScalar::GetBaseType(index).bInline;
+		}
+
+		// Must be empty
+		template <typename T>
+		inline void Emplace(const T& value, std::true_type /*inline*/) noexcept
+		{
+			new (m_aData) T(value);
+			m_iTag = (int)ULTReflection::TypeIndex_t<T>::value;
+		}
+
+		template <typename T>
+		inline void Emplace(const T& value, std::false_type /*spilled*/)
+		{
+			m_pSpill = new UltaType(value);
+			m_iTag = g_iSpilled;
+		}
+
+		template <typename T>
+		inline void Assign(const T& value, std::true_type /*inline*/) noexcept
+		{
+			Reset();
+			Emplace(value, std::true_type());
+		}
+
+		template <typename T>
+		inline void Assign(const T& value, std::false_type /*spilled*/)
+		{
+			if (m_iTag == g_iSpilled)
+			{
+				*m_pSpill = value; // Keeps allocation
+				return;
+			}
+			UltaType* spill = new UltaType(value);
+			Reset();
+			m_pSpill = spill;
+			m_iTag = g_iSpilled;
+		}
+
+		// Must be empty
+		inline void ConstructFrom(const UltaTypeView& view)
+		{
+			if (!view.GetTypeOps()) return;
+			if (IsInline(view))
+			{
+				memcpy(m_aData, view.GetData(), view.GetSize());
+				m_iTag = (int)view.GetTypeIndex();
+				return;
+			}
+			m_pSpill = new UltaType(view);
+			m_iTag = g_iSpilled;
+		}
+
+	private:
+		union
+		{
+			unsigned long long m_uiBits; // Whole payload, for copying and alignment
+			unsigned char m_aData[sizeof(unsigned long long)];
+			UltaType* m_pSpill;
+		};
+		int m_iTag; // ULTReflection::BaseTypes_t of stored number, g_iEmpty or g_iSpilled
+	};
+
+	static_assert(sizeof(UltaScalar) <= 16, "UltaScalar must stay 16 bytes");
+
+#if __cplusplus < 201703L
+	constexpr int UltaScalar::g_iEmpty;
+	constexpr int UltaScalar::g_iSpilled;
+#endif
+} // namespace ULT
+
+#endif
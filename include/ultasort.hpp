@@ -0,0 +1,236 @@
+/*
+============================================
+- File: ultasort.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Sorting and binary search
+  for collections of UltaType.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTASORT_HPP
+#define ULTASORT_HPP
+
+#include "ultatype.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+#ifndef ULTATYPE_SORT_SMALL_SIZE
+#define ULTATYPE_SORT_SMALL_SIZE 64
+#endif
+
+namespace ULT
+{
+	namespace ULTSort
+	{
+		// Strict weak ordering over any values, see ULTCompare::TotalCompare
+		struct TotalLess_t
+		{
+			inline bool operator()(const UltaTypeView& a, const UltaTypeView& b) const
+			{
+				return ULTCompare::TotalCompare(a, b) < 0;
+			}
+		};
+
+		struct __ULTRadixEntry_t
+		{
+			uint64_t ziKey;
+			size_t ziIndex;
+		};
+
+		template <typename T>
+		inline uint64_t __ultSignedKey(T value) noexcept
+		{
+			return (uint64_t)(int64_t)value ^ ((uint64_t)1 << 63);
+		}
+
+		template <typename U, typename F>
+		inline uint64_t __ultFloatKey(F value) noexcept
+		{
+			static_assert(sizeof(U) == sizeof(F), "Key type must have size of floating type");
+			constexpr unsigned iBits = sizeof(U) * 8;
+			if (value != value) return ~(uint64_t)0; // Every NaN is greater than any number
+			if (value == 0) value = 0;				  // -0.0 == 0.0
+
+			U bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const U sign = (U)1 << (iBits - 1);
+			return (uint64_t)((bits & sign) ? (U)~bits : (U)(bits | sign));
+		}
+
+		// Maps value to unsigned key with the same order. Returns false if type has no such mapping.
+		inline bool __ultRadixKey(int typeIndex, const void* data, uint64_t& key) noexcept
+		{
+			using ULTReflection::BaseTypes_t;
+			switch ((BaseTypes_t)typeIndex)
+			{
+			case BaseTypes_t::TYPE_CHAR:
+				key = std::is_signed<char>::value ? __ultSignedKey(*(const char*)data)
+												  : (uint64_t)(unsigned char)*(const char*)data;
+				return true;
+			case BaseTypes_t::TYPE_SHORT:
+				key = __ultSignedKey(*(const short*)data);
+				return true;
+			case BaseTypes_t::TYPE_INT:
+				key = __ultSignedKey(*(const int*)data);
+				return true;
+			case BaseTypes_t::TYPE_LONG:
+				key = __ultSignedKey(*(const long*)data);
+				return true;
+			case BaseTypes_t::TYPE_LONGLONG:
+				key = __ultSignedKey(*(const long long*)data);
+				return true;
+			case BaseTypes_t::TYPE_UCHAR:
+				key = *(const unsigned char*)data;
+				return true;
+			case BaseTypes_t::TYPE_USHORT:
+				key = *(const unsigned short*)data;
+				return true;
+			case BaseTypes_t::TYPE_UINT:
+				key = *(const unsigned int*)data;
+				return true;
+			case BaseTypes_t::TYPE_ULONG:
+				key = *(const unsigned long*)data;
+				return true;
+			case BaseTypes_t::TYPE_ULONGLONG:
+				key = *(const unsigned long long*)data;
+				return true;
+			case BaseTypes_t::TYPE_FLOAT:
+				key = __ultFloatKey<uint32_t>(*(const float*)data);
+				return true;
+			case BaseTypes_t::TYPE_DOUBLE:
+				key = __ultFloatKey<uint64_t>(*(const double*)data);
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		// Stable LSD radix sort by 8 bit digits. Digits that are same for every key are skipped.
+		inline void __ultRadixSort(std::vector<__ULTRadixEntry_t>& entries, std::vector<__ULTRadixEntry_t>& buffer)
+		{
+			const size_t n = entries.size();
+			size_t counts[8][256] = {};
+			for (const __ULTRadixEntry_t& e : entries)
+				for (unsigned pass = 0; pass < 8; pass++) counts[pass][(e.ziKey >> (pass * 8)) & 0xFF]++;
+
+			buffer.resize(n);
+			__ULTRadixEntry_t* src = entries.data();
+			__ULTRadixEntry_t* dst = buffer.data();
+			for (unsigned pass = 0; pass < 8; pass++)
+			{
+				size_t* count = counts[pass];
+				if (count[(src[0].ziKey >> (pass * 8)) & 0xFF] == n) continue;
+
+				size_t offset = 0;
+				for (unsigned digit = 0; digit < 256; digit++)
+				{
+					const size_t c = count[digit];
+					count[digit] = offset;
+					offset += c;
+				}
+				for (size_t i = 0; i < n; i++) dst[count[(src[i].ziKey >> (pass * 8)) & 0xFF]++] = src[i];
+				std::swap(src, dst);
+			}
+			if (src != entries.data()) entries.swap(buffer);
+		}
+	} // namespace ULTSort
+
+	// Sorts range of UltaType by ULTCompare::TotalCompare. Sort is stable.
+	// Values are split by type: numbers with 64 bit keys are radix sorted, strings are compared directly,
+	// and then numeric runs are merged.
+	template <typename It>
+	inline void Sort(It first, It last)
+	{
+		using namespace ULTSort;
+		using ULTReflection::BaseTypes_t;
+
+		const size_t n = (size_t)std::distance(first, last);
+		if (n < ULTATYPE_SORT_SMALL_SIZE)
+		{
+			std::stable_sort(first, last, TotalLess_t());
+			return;
+		}
+
+		std::vector<__ULTRadixEntry_t> radix[(size_t)BaseTypes_t::TYPE_COUNT];
+		std::vector<size_t> empty, numbers, strings, others;
+		for (size_t i = 0; i < n; i++)
+		{
+			const UltaTypeView value = first[i];
+			const int index = (int)value.GetTypeIndex();
+			uint64_t key;
+			if (!value.GetTypeOps())
+				empty.push_back(i);
+			else if (__ultRadixKey(index, value.GetData(), key))
+				radix[index].push_back({key, i});
+			else if (index == (int)BaseTypes_t::TYPE_STDSTRING)
+				strings.push_back(i);
+			else if (ULTReflection::IsBaseType(index))
+				numbers.push_back(i); // long double
+			else
+				others.push_back(i);
+		}
+
+		const auto numberLess = [first](size_t a, size_t b) {
+			return ULTCompare::TotalCompare(first[a], first[b]) < 0;
+		};
+
+		std::stable_sort(numbers.begin(), numbers.end(), numberLess);
+		std::vector<__ULTRadixEntry_t> buffer;
+		for (std::vector<__ULTRadixEntry_t>& entries : radix)
+		{
+			if (entries.empty()) continue;
+			__ultRadixSort(entries, buffer);
+
+			const size_t mid = numbers.size();
+			for (const __ULTRadixEntry_t& e : entries) numbers.push_back(e.ziIndex);
+			std::inplace_merge(numbers.begin(), numbers.begin() + mid, numbers.end(), numberLess);
+			std::vector<__ULTRadixEntry_t>().swap(entries);
+		}
+
+		std::stable_sort(strings.begin(), strings.end(), [first](size_t a, size_t b) {
+			const UltaTypeView x = first[a];
+			const UltaTypeView y = first[b];
+			return x.GetValueHard<std::string>() < y.GetValueHard<std::string>();
+		});
+		std::stable_sort(others.begin(), others.end(), numberLess);
+
+		std::vector<UltaType> sorted;
+		sorted.reserve(n);
+		for (const std::vector<size_t>* run : {&empty, &numbers, &strings, &others})
+			for (size_t i : *run) sorted.push_back(std::move(first[i]));
+		std::move(sorted.begin(), sorted.end(), first);
+	}
+
+	template <typename C>
+	inline void Sort(C& container)
+	{
+		Sort(std::begin(container), std::end(container));
+	}
+
+	// Range must be sorted by ULT::Sort
+	template <typename It>
+	inline It LowerBound(It first, It last, const UltaTypeView& value)
+	{
+		return std::lower_bound(first, last, value, ULTSort::TotalLess_t());
+	}
+
+	template <typename It>
+	inline It UpperBound(It first, It last, const UltaTypeView& value)
+	{
+		return std::upper_bound(first, last, value, ULTSort::TotalLess_t());
+	}
+
+	template <typename It>
+	inline std::pair<It, It> EqualRange(It first, It last, const UltaTypeView& value)
+	{
+		return std::equal_range(first, last, value, ULTSort::TotalLess_t());
+	}
+} // namespace ULT
+
+#endif
@@ -3,7 +3,7 @@
 - File: ultatype.hpp
 - Author: Vadim "VAX325"
 - Creation date: 26.05.2023 / 15:10
-- Last edit date: 14.07.2023 / 14:08
+- Last edit date: 17.10.2026 / 10:00
 - Description: UltaType is wrapper class for
   storing almost any type of data.
 - MIT Licensed. (See LICENSE for more info)
@@ -19,17 +19,86 @@
 #include <string>
 #if __cplusplus >= 201703L
 #include <string_view>
+#include <optional>
 #endif
 #include <string.h>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <new>
+#include <utility>
 #include <map>
+#include <vector>
+#include <limits>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <system_error>
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define __ULTATYPE_HAS_MEMORY_RESOURCE
+#endif
+#if __has_include(<charconv>)
+#include <charconv>
+#define __ULTATYPE_HAS_CHARCONV
+#endif
+#endif
+#if defined(ULTATYPE_ENABLE_STATS) || defined(ULTATYPE_SAVE_TYPENAME) || defined(ULTATYPE_SHARED_PAYLOADS)
+#include <atomic>
+#include <mutex>
+#endif
+#ifdef ULTATYPE_SAVE_TYPENAME
+#include <typeindex>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+#endif
+
+#ifndef ULTATYPE_INLINE_SIZE
+#define ULTATYPE_INLINE_SIZE 16
+#endif
+
+#ifndef ULTATYPE_ARENA_CHUNK_SIZE
+#define ULTATYPE_ARENA_CHUNK_SIZE 65536
+#endif
+
+#ifndef ULTATYPE_REGISTRY_MAX_PROBES
+#define ULTATYPE_REGISTRY_MAX_PROBES 8
+#endif
+
+// Trivially copyable values from this size on are shared by copies with ULTATYPE_SHARED_PAYLOADS
+#ifndef ULTATYPE_SHARED_MIN_SIZE
+#define ULTATYPE_SHARED_MIN_SIZE 64
+#endif
+
+// Accessors giving mutable payload may have to copy shared payload first, so they can throw then
+#ifdef ULTATYPE_SHARED_PAYLOADS
+#define __ULTATYPE_ACCESS_NOEXCEPT
+#else
+#define __ULTATYPE_ACCESS_NOEXCEPT noexcept
+#endif
+
+// Batch kernels are additionally built for AVX2 and picked at load time, where GCC supports it
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__ELF__) &&                             \
+	!defined(ULTATYPE_NO_TARGET_CLONES)
+#define __ULTATYPE_BATCH_KERNEL __attribute__((target_clones("avx2", "default")))
+#else
+#define __ULTATYPE_BATCH_KERNEL
+#endif
+
+// Statement is compiled only with ULTATYPE_ENABLE_STATS, see ULT::ULTStats
+#ifdef ULTATYPE_ENABLE_STATS
+#define __ULTATYPE_STAT(x) x
+#else
+#define __ULTATYPE_STAT(x)
+#endif
 
 namespace ULT
 {
 #ifdef ULTATYPE_SAVE_TYPENAME
 #ifdef __GNUG__
-#include <cstdlib>
-#include <cxxabi.h>
 	static inline const std::string demangle(const char* const name)
 	{
 		int status = -4;
@@ -43,12 +112,30 @@ namespace ULT
 	static inline const std::string demangle(const char* const name) { return name; }
 #endif
 #endif
+
+	namespace ULTReflection
+	{
+		// Demangled name of type, interned: every type is demangled once per program
+		// and returned string stays valid until exit. Thread safe.
+		inline const std::string& GetTypeName(const std::type_info& type)
+		{
+			static std::mutex g_Mutex;
+			static std::map<std::type_index, std::string> g_Names;
+
+			std::lock_guard<std::mutex> lock(g_Mutex);
+			std::map<std::type_index, std::string>::iterator it = g_Names.find(type);
+			if (it == g_Names.end()) it = g_Names.emplace(type, std::string(demangle(type.name()))).first;
+			return it->second;
+		}
+	} // namespace ULTReflection
 #endif
 
 	namespace ULTReflection
 	{
 		enum class BaseTypes_t : int
 		{
+			TYPE_UNKNOWN = -1, // Not a base type, dispatched through slow path
+
 			TYPE_CHAR,
 			TYPE_SHORT,
 			TYPE_INT,
@@ -66,6 +153,8 @@ namespace ULT
 			TYPE_LONGDOUBLE,
 
 			TYPE_STDSTRING,
+
+			TYPE_COUNT
 		};
 
 #define __ULTATYPE_TYPE_ID_DEFINE(x, y)                                                                                \
@@ -73,475 +162,2385 @@ namespace ULT
 		typeid(x).hash_code(), (int)y                                                                                  \
 	}
 
-		static std::map<size_t, int> g_TypesIdentify = {
-			__ULTATYPE_TYPE_ID_DEFINE(char, BaseTypes_t::TYPE_CHAR),
-			__ULTATYPE_TYPE_ID_DEFINE(short, BaseTypes_t::TYPE_SHORT),
-			__ULTATYPE_TYPE_ID_DEFINE(int, BaseTypes_t::TYPE_INT),
-			__ULTATYPE_TYPE_ID_DEFINE(long, BaseTypes_t::TYPE_LONG),
-			__ULTATYPE_TYPE_ID_DEFINE(long long, BaseTypes_t::TYPE_LONGLONG),
-
-			__ULTATYPE_TYPE_ID_DEFINE(unsigned char, BaseTypes_t::TYPE_UCHAR),
-			__ULTATYPE_TYPE_ID_DEFINE(unsigned short, BaseTypes_t::TYPE_USHORT),
-			__ULTATYPE_TYPE_ID_DEFINE(unsigned int, BaseTypes_t::TYPE_UINT),
-			__ULTATYPE_TYPE_ID_DEFINE(unsigned long, BaseTypes_t::TYPE_ULONG),
-			__ULTATYPE_TYPE_ID_DEFINE(unsigned long long, BaseTypes_t::TYPE_ULONGLONG),
+		// Program-wide map from type hash to BaseTypes_t, built on first use
+		inline const std::map<size_t, int>& GetTypesIdentify()
+		{
+			static const std::map<size_t, int> g_TypesIdentify = {
+				__ULTATYPE_TYPE_ID_DEFINE(char, BaseTypes_t::TYPE_CHAR),
+				__ULTATYPE_TYPE_ID_DEFINE(short, BaseTypes_t::TYPE_SHORT),
+				__ULTATYPE_TYPE_ID_DEFINE(int, BaseTypes_t::TYPE_INT),
+				__ULTATYPE_TYPE_ID_DEFINE(long, BaseTypes_t::TYPE_LONG),
+				__ULTATYPE_TYPE_ID_DEFINE(long long, BaseTypes_t::TYPE_LONGLONG),
+
+				__ULTATYPE_TYPE_ID_DEFINE(unsigned char, BaseTypes_t::TYPE_UCHAR),
+				__ULTATYPE_TYPE_ID_DEFINE(unsigned short, BaseTypes_t::TYPE_USHORT),
+				__ULTATYPE_TYPE_ID_DEFINE(unsigned int, BaseTypes_t::TYPE_UINT),
+				__ULTATYPE_TYPE_ID_DEFINE(unsigned long, BaseTypes_t::TYPE_ULONG),
+				__ULTATYPE_TYPE_ID_DEFINE(unsigned long long, BaseTypes_t::TYPE_ULONGLONG),
+
+				__ULTATYPE_TYPE_ID_DEFINE(float, BaseTypes_t::TYPE_FLOAT),
+				__ULTATYPE_TYPE_ID_DEFINE(double, BaseTypes_t::TYPE_DOUBLE),
+				__ULTATYPE_TYPE_ID_DEFINE(long double, BaseTypes_t::TYPE_LONGDOUBLE),
+
+				__ULTATYPE_TYPE_ID_DEFINE(std::string, BaseTypes_t::TYPE_STDSTRING),
+			};
+			return g_TypesIdentify;
+		}
 
-			__ULTATYPE_TYPE_ID_DEFINE(float, BaseTypes_t::TYPE_FLOAT),
-			__ULTATYPE_TYPE_ID_DEFINE(double, BaseTypes_t::TYPE_DOUBLE),
-			__ULTATYPE_TYPE_ID_DEFINE(long double, BaseTypes_t::TYPE_LONGDOUBLE),
+#undef __ULTATYPE_TYPE_ID_DEFINE
 
-			__ULTATYPE_TYPE_ID_DEFINE(std::string, BaseTypes_t::TYPE_STDSTRING),
+		template <typename T>
+		struct TypeIndex_t : std::integral_constant<BaseTypes_t, BaseTypes_t::TYPE_UNKNOWN>
+		{
 		};
 
-#undef __ULTATYPE_TYPE_ID_DEFINE
-	} // namespace ULTReflection
+#define __ULTATYPE_TYPE_INDEX_DEFINE(x, y)                                                                             \
+	template <>                                                                                                        \
+	struct TypeIndex_t<x> : std::integral_constant<BaseTypes_t, y>                                                     \
+	{                                                                                                                  \
+	}
 
-	namespace ULTConvert
-	{
-		struct FromString_t
-		{
-		private:
-			const std::string& source;
+		__ULTATYPE_TYPE_INDEX_DEFINE(char, BaseTypes_t::TYPE_CHAR);
+		__ULTATYPE_TYPE_INDEX_DEFINE(short, BaseTypes_t::TYPE_SHORT);
+		__ULTATYPE_TYPE_INDEX_DEFINE(int, BaseTypes_t::TYPE_INT);
+		__ULTATYPE_TYPE_INDEX_DEFINE(long, BaseTypes_t::TYPE_LONG);
+		__ULTATYPE_TYPE_INDEX_DEFINE(long long, BaseTypes_t::TYPE_LONGLONG);
 
-		public:
-			FromString_t(const std::string& src) : source(src) {}
+		__ULTATYPE_TYPE_INDEX_DEFINE(unsigned char, BaseTypes_t::TYPE_UCHAR);
+		__ULTATYPE_TYPE_INDEX_DEFINE(unsigned short, BaseTypes_t::TYPE_USHORT);
+		__ULTATYPE_TYPE_INDEX_DEFINE(unsigned int, BaseTypes_t::TYPE_UINT);
+		__ULTATYPE_TYPE_INDEX_DEFINE(unsigned long, BaseTypes_t::TYPE_ULONG);
+		__ULTATYPE_TYPE_INDEX_DEFINE(unsigned long long, BaseTypes_t::TYPE_ULONGLONG);
 
-			inline operator char() const { return (char)std::stoi(source); }
-			inline operator short() const { return (short)std::stoi(source); }
-			inline operator int() const { return std::stoi(source); }
-			inline operator long() const { return std::stol(source); }
-			inline operator long long() const { return std::stoll(source); }
+		__ULTATYPE_TYPE_INDEX_DEFINE(float, BaseTypes_t::TYPE_FLOAT);
+		__ULTATYPE_TYPE_INDEX_DEFINE(double, BaseTypes_t::TYPE_DOUBLE);
+		__ULTATYPE_TYPE_INDEX_DEFINE(long double, BaseTypes_t::TYPE_LONGDOUBLE);
 
-			inline operator unsigned char() const { return (unsigned char)std::stoul(source); }
-			inline operator unsigned short() const { return (unsigned short)std::stoul(source); }
-			inline operator unsigned int() const { return (unsigned int)std::stoul(source); }
-			inline operator unsigned long() const { return std::stoul(source); }
-			inline operator unsigned long long() const { return std::stoull(source); }
+		__ULTATYPE_TYPE_INDEX_DEFINE(std::string, BaseTypes_t::TYPE_STDSTRING);
 
-			inline operator float() const { return std::stof(source); }
-			inline operator double() const { return std::stod(source); }
-			inline operator long double() const { return std::stold(source); }
-		};
+#undef __ULTATYPE_TYPE_INDEX_DEFINE
 
-		template <typename S, typename T>
-		inline void __utBaseConverter(const void* a, const void* dst)
+		template <typename... Ts>
+		struct __ULTTypeList_t
 		{
-			const S& val = *(S*)a;
-			*(T*)dst = static_cast<T>(val);
-		}
-
-#define __ULTATYPE_BASE_CONVERTER_DEFINE(s, t)                                                                         \
-	{                                                                                                                  \
-		{typeid(s).hash_code(), typeid(t).hash_code()}, ULT::ULTConvert::__utBaseConverter<s, t>                       \
-	}
-#define __ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(x)                                                                      \
-	__ULTATYPE_BASE_CONVERTER_DEFINE(x, char), __ULTATYPE_BASE_CONVERTER_DEFINE(x, short),                             \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, int), __ULTATYPE_BASE_CONVERTER_DEFINE(x, long),                           \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, long long), __ULTATYPE_BASE_CONVERTER_DEFINE(x, unsigned char),            \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, unsigned short), __ULTATYPE_BASE_CONVERTER_DEFINE(x, unsigned int),        \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, unsigned long), __ULTATYPE_BASE_CONVERTER_DEFINE(x, unsigned long long),   \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, float), __ULTATYPE_BASE_CONVERTER_DEFINE(x, double),                       \
-		__ULTATYPE_BASE_CONVERTER_DEFINE(x, long double)
-
-#define __ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(c, s, t)                                                               \
-	{                                                                                                                  \
-		{typeid(s).hash_code(), typeid(t).hash_code()}, c<s>                                                           \
-	}
+		};
 
-#define __ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(c, s, t)                                                               \
-	{                                                                                                                  \
-		{typeid(s).hash_code(), typeid(t).hash_code()}, c<t>                                                           \
-	}
+		// Must follow BaseTypes_t order, dense tables are indexed by it
+		using BaseTypesList_t =
+			__ULTTypeList_t<char, short, int, long, long long, unsigned char, unsigned short, unsigned int,
+							unsigned long, unsigned long long, float, double, long double, std::string>;
 
-		template <typename S>
-		inline void __ultToStringConverter(const void* a, const void* dst /*std::string*/)
+		template <typename... Ts>
+		constexpr bool __ultIsDenseOrdered(__ULTTypeList_t<Ts...>)
 		{
-			const S val = *(S*)a;
-			*(std::string*)dst = std::to_string(val);
+			const int indices[] = {(int)TypeIndex_t<Ts>::value...};
+			for (int i = 0; i < (int)sizeof...(Ts); i++)
+				if (indices[i] != i) return false;
+			return sizeof...(Ts) == (size_t)BaseTypes_t::TYPE_COUNT;
 		}
+		static_assert(__ultIsDenseOrdered(BaseTypesList_t()), "BaseTypesList_t doesn't match BaseTypes_t");
 
-		template <typename T>
-		inline void __ultFromStringConverter(const void* a /*std::string*/, const void* dst)
+		template <typename F, size_t N>
+		struct DenseRow_t
 		{
-			const std::string& val = *(std::string*)a;
-			*(T*)dst = static_cast<T>(FromString_t(val));
+			F v[N];
+		};
+
+		template <template <typename...> class Pick, typename F, typename S, typename... Ts>
+		constexpr DenseRow_t<F, sizeof...(Ts)> __ultDenseRow(__ULTTypeList_t<Ts...>)
+		{
+			return {{Pick<S, Ts>::value...}};
 		}
 
-		using Converter_t = void (*)(const void* src, const void* dst);
-		static std::map<std::tuple<size_t, size_t>, Converter_t> g_UTConverters = {
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(char),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(short),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(int),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(long),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(long long),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(unsigned char),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(unsigned short),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(unsigned int),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(unsigned long),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(unsigned long long),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(float),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(double),
-			__ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH(long double),
-
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, char, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, short, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, int, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, long, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, long long, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, unsigned char, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, unsigned short, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, unsigned int, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, unsigned long, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, unsigned long long, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, float, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, double, std::string),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T(__ultToStringConverter, long double, std::string),
-
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, char),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, short),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, int),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, long),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, long long),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, unsigned char),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, unsigned short),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, unsigned int),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, unsigned long),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, unsigned long long),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, float),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, double),
-			__ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S(__ultFromStringConverter, std::string, long double),
-		};
-
-#undef __ULTATYPE_BASE_CONVERTER_DEFINE
-#undef __ULTATYPE_BASE_CONVERTER_DEFINE_BUNCH
-#undef __ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_T
-#undef __ULTATYPE_CUSTOM_CONVERTER_DEFINE_NO_S
-	} // namespace ULTConvert
+		// [N][N] table of Pick<A, B>::value over every pair of listed types, built at compile time
+		template <template <typename...> class Pick, typename F, typename List>
+		struct DenseTable_t;
 
-	namespace ULTCompare
-	{
-		template <typename T1, typename T2>
-		inline const char __ultBaseComparer(const void* a, const void* b)
+		template <template <typename...> class Pick, typename F, typename... Ts>
+		struct DenseTable_t<Pick, F, __ULTTypeList_t<Ts...>>
 		{
-#pragma warning(push)
-#pragma warning(disable : 4018)
-			const T1& aT = *(T1*)a;
-			const T2& bT = *(T2*)b;
-			if (aT < bT)
-				return -1;
-			else if (aT == bT)
-				return 0;
-			else /*if (aT > bT)*/
-				return 1;
-#pragma warning(pop)
-		}
+			static constexpr DenseRow_t<F, sizeof...(Ts)> rows[sizeof...(Ts)] = {
+				__ultDenseRow<Pick, F, Ts>(__ULTTypeList_t<Ts...>())...};
 
-#define __ULTATYPE_BASE_COMPARER_DEFINE(a, b)                                                                          \
-	{                                                                                                                  \
-		{typeid(a).hash_code(), typeid(b).hash_code()}, ULT::ULTCompare::__ultBaseComparer<a, b>                       \
-	}
+			static inline const F& Get(int a, int b) noexcept { return rows[a].v[b]; }
+		};
 
-#define __ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(x)                                                                       \
-	__ULTATYPE_BASE_COMPARER_DEFINE(x, char), __ULTATYPE_BASE_COMPARER_DEFINE(x, short),                               \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, int), __ULTATYPE_BASE_COMPARER_DEFINE(x, long),                             \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, long long), __ULTATYPE_BASE_COMPARER_DEFINE(x, unsigned char),              \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, unsigned short), __ULTATYPE_BASE_COMPARER_DEFINE(x, unsigned int),          \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, unsigned long), __ULTATYPE_BASE_COMPARER_DEFINE(x, unsigned long long),     \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, float), __ULTATYPE_BASE_COMPARER_DEFINE(x, double),                         \
-		__ULTATYPE_BASE_COMPARER_DEFINE(x, long double)
+#if __cplusplus < 201703L
+		template <template <typename...> class Pick, typename F, typename... Ts>
+		constexpr DenseRow_t<F, sizeof...(Ts)> DenseTable_t<Pick, F, __ULTTypeList_t<Ts...>>::rows[sizeof...(Ts)];
+#endif
 
-		using Comparer_t = const char (*)(const void* a, const void* b);
-		static std::map<std::tuple<size_t, size_t>, Comparer_t> g_UTComparers = {
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(char),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(short),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(int),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(long),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(long long),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(unsigned char),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(unsigned short),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(unsigned int),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(unsigned long),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(unsigned long long),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(float),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(double),
-			__ULTATYPE_BASE_COMPARER_DEFINE_BUNCH(long double),
-
-			__ULTATYPE_BASE_COMPARER_DEFINE(std::string, std::string),
-		};
-
-#undef __ULTATYPE_BASE_COMPARER_DEFINE
-#undef __ULTATYPE_BASE_COMPARER_DEFINE_BUNCH
-	} // namespace ULTCompare
+		inline bool IsBaseType(int index) noexcept { return index >= 0 && index < (int)BaseTypes_t::TYPE_COUNT; }
 
-	namespace ULTOperations
-	{
-		struct AbstractOperator_t
+		// Open addressing table keyed by pair of type hashes. Lookup never probes more than
+		// ULTATYPE_REGISTRY_MAX_PROBES slots, insertion grows the table instead of probing further.
+		template <typename V>
+		class TypePairRegistry_t
 		{
-			virtual void Plus(const void* a, const void* b, void* result) = 0;
-			virtual void Minus(const void* a, const void* b, void* result) = 0;
-			virtual void Multiply(const void* a, const void* b, void* result) = 0;
-			virtual void Divide(const void* a, const void* b, void* result) = 0;
-		};
+		private:
+			struct Slot_t
+			{
+				size_t ziA;
+				size_t ziB;
+				V value;
+				bool bUsed;
+			};
 
-#pragma warning(push)
-#pragma warning(disable : 4244)
-		template <typename A, typename B>
-		struct __ULTBaseTOperator_t : public AbstractOperator_t
-		{
-			virtual void Plus(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+		public:
+			TypePairRegistry_t() : m_ziCount(0) {}
+
+			// Returns false if pair was already registered, its value is replaced then
+			bool Insert(size_t a, size_t b, const V& value)
 			{
-				const A& aA = *(A*)a;
-				const B& bB = *(B*)b;
-				*(A*)result = aA + bB;
+				if ((m_ziCount + 1) * 2 > m_vSlots.size()) Rehash(m_vSlots.empty() ? 16 : m_vSlots.size() * 2);
+
+				for (;;)
+				{
+					const size_t mask = m_vSlots.size() - 1;
+					const size_t start = Mix(a, b);
+					for (size_t i = 0; i < ULTATYPE_REGISTRY_MAX_PROBES; i++)
+					{
+						Slot_t& slot = m_vSlots[(start + i) & mask];
+						if (!slot.bUsed)
+						{
+							slot = {a, b, value, true};
+							m_ziCount++;
+							return true;
+						}
+						if (slot.ziA == a && slot.ziB == b)
+						{
+							slot.value = value;
+							return false;
+						}
+					}
+					Rehash(m_vSlots.size() * 2);
+				}
 			}
 
-			virtual void Minus(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			const V* Find(size_t a, size_t b) const noexcept
 			{
-				const A& aA = *(A*)a;
-				const B& bB = *(B*)b;
-				*(A*)result = aA - bB;
+				if (m_vSlots.empty()) return nullptr;
+
+				const size_t mask = m_vSlots.size() - 1;
+				const size_t start = Mix(a, b);
+				for (size_t i = 0; i < ULTATYPE_REGISTRY_MAX_PROBES; i++)
+				{
+					const Slot_t& slot = m_vSlots[(start + i) & mask];
+					if (!slot.bUsed) return nullptr;
+					if (slot.ziA == a && slot.ziB == b) return &slot.value;
+				}
+				return nullptr;
 			}
 
-			virtual void Multiply(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			inline size_t Size() const noexcept { return m_ziCount; }
+
+		private:
+			static inline size_t Mix(size_t a, size_t b) noexcept
 			{
-				const A& aA = *(A*)a;
-				const B& bB = *(B*)b;
-				*(A*)result = aA * bB;
+				unsigned long long x = (unsigned long long)a * 0x9E3779B97F4A7C15ull ^ (unsigned long long)b;
+				x ^= x >> 31;
+				x *= 0xBF58476D1CE4E5B9ull;
+				x ^= x >> 29;
+				return (size_t)x;
 			}
 
-			virtual void Divide(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			void Rehash(size_t capacity)
 			{
-				const A& aA = *(A*)a;
-				const B& bB = *(B*)b;
-				*(A*)result = aA / bB;
+				std::vector<Slot_t> old;
+				old.swap(m_vSlots);
+				m_vSlots.assign(capacity, Slot_t{0, 0, V(), false});
+				m_ziCount = 0;
+				for (const Slot_t& slot : old)
+					if (slot.bUsed) Insert(slot.ziA, slot.ziB, slot.value);
 			}
-		};
-#pragma warning(pop)
 
-#define __ULTATYPE_BASE_OPERATOR_DEFINE(x, y)                                                                          \
-	{                                                                                                                  \
-		{typeid(x).hash_code(), typeid(y).hash_code()}, new __ULTBaseTOperator_t<x, y>()                               \
-	}
+		private:
+			std::vector<Slot_t> m_vSlots; // Size is always power of 2
+			size_t m_ziCount;
+		};
 
-#define __ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(x)                                                                       \
-	__ULTATYPE_BASE_OPERATOR_DEFINE(x, char), __ULTATYPE_BASE_OPERATOR_DEFINE(x, short),                               \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, int), __ULTATYPE_BASE_OPERATOR_DEFINE(x, long),                             \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, long long), __ULTATYPE_BASE_OPERATOR_DEFINE(x, unsigned char),              \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, unsigned short), __ULTATYPE_BASE_OPERATOR_DEFINE(x, unsigned int),          \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, unsigned long), __ULTATYPE_BASE_OPERATOR_DEFINE(x, unsigned long long),     \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, float), __ULTATYPE_BASE_OPERATOR_DEFINE(x, double),                         \
-		__ULTATYPE_BASE_OPERATOR_DEFINE(x, long double)
-
-		static std::map<std::tuple<size_t, size_t>, AbstractOperator_t*> g_Operators = {
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(char),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(short),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(int),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(long),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(long long),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(unsigned char),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(unsigned short),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(unsigned int),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(unsigned long),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(unsigned long long),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(float),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(double),
-			__ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH(long double),
-		};
-
-#undef __ULTATYPE_BASE_OPERATOR_DEFINE_BUNCH
-#undef __ULTATYPE_BASE_OPERATOR_DEFINE
-	} // namespace ULTOperations
+		// Small values that can be moved without throwing (all of the numeric BaseTypes_t) are kept
+		// right inside UltaType, everything else goes to the heap
+		template <typename T>
+		struct StoresInline_t
+			: std::integral_constant<bool, sizeof(T) <= ULTATYPE_INLINE_SIZE &&
+											   alignof(T) <= alignof(std::max_align_t) &&
+											   std::is_nothrow_move_constructible<T>::value>
+		{
+		};
 
-	class UltaType final
-	{
-	private:
-#ifndef ULTATYPE_BYTE_TYPE
-#if __cplusplus >= 201703L
-		using UltaTypeByte_t = std::byte;
-#else
-		using UltaTypeByte_t = unsigned char;
-#endif
+		// With ULTATYPE_SHARED_PAYLOADS copies of a heap value share one reference counted block until one of them
+		// is changed. Default is types owning memory (strings, containers) and trivially copyable ones of
+		// ULTATYPE_SHARED_MIN_SIZE bytes and more, specialize it to opt a type in or out.
+		template <typename T>
+		struct SharesPayload_t
+			: std::integral_constant<bool,
+#ifdef ULTATYPE_SHARED_PAYLOADS
+									 !StoresInline_t<T>::value && (!std::is_trivially_copyable<T>::value ||
+																   sizeof(T) >= ULTATYPE_SHARED_MIN_SIZE)
 #else
-		using UltaTypeByte_t = ULTATYPE_BYTE_TYPE;
+									 false
 #endif
+									 >
+		{
+		};
 
+		// Lifecycle of a stored type, created once per T and shared by every UltaType holding a T
+		struct TypeOps_t
+		{
+			void (*CopyConstruct)(const void* src, void* dst);
+			void (*MoveConstruct)(void* src, void* dst) noexcept;
+			void (*CopyAssign)(const void* src, void* dst);
+			void (*Destroy)(void* obj) noexcept;
+			size_t (*Hash)(const void* obj); // std::hash<T>, nullptr if T has no such specialization
+			const std::type_info* pTypeInfo;
+			size_t ziSize;
+			size_t ziAlign;
+			bool bTrivial; // payload can be copied with memcpy and dropped without destroying
+			bool bInline;  // see StoresInline_t
+			bool bShared;  // see SharesPayload_t
 #ifdef ULTATYPE_SAVE_TYPENAME
-#if __cplusplus >= 201703L
-		using UltaTypeName_t = std::string_view;
-#else
-		using UltaTypeName_t = std::string;
+			mutable std::atomic<const std::string*> aName; // Interned name, nullptr until first GetTypeName
 #endif
-#endif
-
-		static_assert(sizeof(UltaTypeByte_t) == 1,
-					  "Can't recognize byte type! Please, define it manualy with ULTATYPE_BYTE_TYPE=<byteType> macro");
+		};
 
-	public:
-		inline UltaType() : m_ziTypeHash(0), m_ziTypeSize(0), m_pPtr(nullptr) {}
-		template <typename T>
-		inline UltaType(const T& value) : m_ziTypeHash(0), m_ziTypeSize(0), m_pPtr(nullptr)
-		{
-			SetValue<T>(value);
-		}
+		using Hasher_t = size_t (*)(const void* obj);
 
-		inline void Copy(const UltaType& other)
+		template <typename...>
+		struct __ULTVoid_t
 		{
-			m_ziTypeHash = other.m_ziTypeHash;
-			m_ziTypeSize = other.m_ziTypeSize;
-			m_pPtr = std::make_unique<UltaTypeByte_t[]>(m_ziTypeSize);
-#ifdef ULTATYPE_SAVE_TYPENAME
-			m_strTypeName = other.m_strTypeName;
-#endif
-			memcpy(m_pPtr.get(), other.m_pPtr.get(), m_ziTypeSize);
-		}
+			using type = void;
+		};
 
-		inline UltaType(const UltaType& other) : m_ziTypeHash(0), m_ziTypeSize(0), m_pPtr(nullptr) { Copy(other); }
-		inline UltaType& operator=(const UltaType& other)
+		template <typename T, typename = void>
+		struct __ULTHasherFor_t
 		{
-			Copy(other);
-			return *this;
-		}
-		inline ~UltaType() { m_pPtr.release(); }
+			static constexpr Hasher_t value = nullptr;
+		};
 
 		template <typename T>
-		void SetValue(const T& value)
+		struct __ULTHasherFor_t<
+			T, typename std::enable_if<
+				   std::is_default_constructible<std::hash<T>>::value,
+				   typename __ULTVoid_t<decltype(std::hash<T>()(std::declval<const T&>()))>::type>::type>
 		{
-			const size_t newHash = typeid(value).hash_code();
-			if (newHash != m_ziTypeHash)
-			{
-				m_ziTypeHash = typeid(value).hash_code();
-#ifdef ULTATYPE_SAVE_TYPENAME
-				m_strTypeName = demangle(typeid(value).name());
-#endif
-				m_ziTypeSize = sizeof(value);
-				m_pPtr.release();
-				m_pPtr.reset(new UltaTypeByte_t[m_ziTypeSize]);
-				T& data = *(T*)m_pPtr.get();
-				memcpy(&data, &value, m_ziTypeSize);
-			}
-			else
-			{
-				T& data = *(T*)m_pPtr.get();
-				memcpy(&data, &value, m_ziTypeSize);
-			}
-		}
+			static size_t Hash(const void* obj) { return std::hash<T>()(*(const T*)obj); }
+			static constexpr Hasher_t value = Hash;
+		};
 
 		template <typename T>
-		inline UltaType& operator=(const T& value)
+		struct __ULTTypeOps_t
 		{
-			SetValue<T>(value);
-			return *this;
-		}
+			static void CopyConstruct(const void* src, void* dst) { new (dst) T(*(const T*)src); }
+			static void MoveConstruct(void* src, void* dst) noexcept { new (dst) T(std::move(*(T*)src)); }
+			static void CopyAssign(const void* src, void* dst) { *(T*)dst = *(const T*)src; }
+			static void Destroy(void* obj) noexcept { ((T*)obj)->~T(); }
+
+			static const TypeOps_t ops;
+		};
 
 		template <typename T>
-		inline T* GetPointer() const noexcept
-		{
-			return reinterpret_cast<T*>(m_pPtr.get());
-		}
+		const TypeOps_t __ULTTypeOps_t<T>::ops = {__ULTTypeOps_t<T>::CopyConstruct,
+												   __ULTTypeOps_t<T>::MoveConstruct,
+												   __ULTTypeOps_t<T>::CopyAssign,
+												   __ULTTypeOps_t<T>::Destroy,
+												   __ULTHasherFor_t<T>::value,
+												   &typeid(T),
+												   sizeof(T),
+												   alignof(T),
+												   std::is_trivially_copyable<T>::value,
+												   StoresInline_t<T>::value,
+												   SharesPayload_t<T>::value,
+#ifdef ULTATYPE_SAVE_TYPENAME
+												   {nullptr},
+#endif
+		};
 
 		template <typename T>
-		inline T& GetValueHard() const noexcept
+		inline const TypeOps_t* GetTypeOps() noexcept
 		{
-			T& ref = *reinterpret_cast<T*>(m_pPtr.get());
-			return ref;
+			return &__ULTTypeOps_t<T>::ops;
 		}
 
-		template <typename T>
-		T& GetValue() const
+#ifdef ULTATYPE_SAVE_TYPENAME
+		// Same as GetTypeName(type_info), but name is cached in ops, so only the first call takes the lock
+		inline const std::string& GetTypeName(const TypeOps_t& ops)
 		{
-			using namespace ULTConvert;
-			static thread_local T g_THLocalTmp;
-
-			if (m_ziTypeHash == typeid(T).hash_code()) return GetValueHard<T>();
-
-			const auto& conv = g_UTConverters.find(std::tuple<size_t, size_t>(m_ziTypeHash, typeid(T).hash_code()));
-			if (conv != g_UTConverters.end())
+			const std::string* name = ops.aName.load(std::memory_order_acquire);
+			if (!name)
 			{
-				T& ref = g_THLocalTmp;
-				conv->second(m_pPtr.get(), (void*)&ref);
-				return ref;
+				name = &GetTypeName(*ops.pTypeInfo);
+				ops.aName.store(name, std::memory_order_release);
 			}
-
-			return GetValueHard<T>();
+			return *name;
 		}
+#endif
 
+		// String literals (char arrays) are stored as std::string of text up to the first '\0'
 		template <typename T>
-		inline operator T&() const
+		inline std::string __ultArrayString(const T& value)
 		{
-			return GetValue<T>();
+			static_assert(std::rank<T>::value == 1 &&
+							  std::is_same<typename std::remove_cv<typename std::remove_extent<T>::type>::type,
+										   char>::value,
+						  "Only char arrays can be stored (as std::string), use std::array or std::vector");
+			const void* end = memchr(value, 0, sizeof(T));
+			return std::string(value, end ? (size_t)((const char*)end - value) : sizeof(T));
 		}
+	} // namespace ULTReflection
 
-		bool operator==(const UltaType& other) const
+#ifdef ULTATYPE_ENABLE_STATS
+	// Counters of dispatch lookups and payload allocations, compiled only with ULTATYPE_ENABLE_STATS.
+	// Every thread counts into its own block, GetSnapshot sums blocks of running and finished threads.
+	namespace ULTStats
+	{
+		enum class Dispatch_t : int
 		{
-			using namespace ULTCompare;
-			const auto& comp = g_UTComparers.find({m_ziTypeHash, other.m_ziTypeHash});
-			if (comp != g_UTComparers.end())
-				return !comp->second(m_pPtr.get(), other.m_pPtr.get()); // ! 'cause 0 - equal
-			return false;
-		}
+			DISPATCH_CONVERT, // GetValue/TryGetAs between different types
+			DISPATCH_COMPARE,
+			DISPATCH_OPERATOR,
 
-		template <typename T>
-		inline bool operator==(const T& other) const
-		{
-			return GetValue<T>() == other;
-		}
+			DISPATCH_COUNT
+		};
 
-		bool operator<(const UltaType& other) const
+		// Lookups of one type pair, ullHits of DISPATCH_CONVERT is number of conversions
+		struct PairCounters_t
 		{
-			using namespace ULTCompare;
-			const auto& comp = g_UTComparers.find({m_ziTypeHash, other.m_ziTypeHash});
-			if (comp != g_UTComparers.end()) return comp->second(m_pPtr.get(), other.m_pPtr.get()) == -1;
-			return false;
-		}
+			unsigned long long ullHits;
+			unsigned long long ullMisses; // No converter/comparer/operator, value was left as is
+		};
 
-		template <typename T>
-		inline bool operator<(const T& other) const
+		struct PairKey_t
 		{
-			return GetValue<T>() < other;
-		}
+			Dispatch_t eDispatch;
+			int iFromIndex; // BaseTypes_t, TYPE_UNKNOWN for other types
+			size_t ziFromHash;
+			int iToIndex;
+			size_t ziToHash;
 
-		bool operator<=(const UltaType& other) const
-		{
-			using namespace ULTCompare;
-			const auto& comp = g_UTComparers.find({m_ziTypeHash, other.m_ziTypeHash});
-			if (comp != g_UTComparers.end())
+			inline bool operator<(const PairKey_t& other) const noexcept
 			{
-				const auto res = comp->second(m_pPtr.get(), other.m_pPtr.get());
-				return res == -1 || res == 0;
+				if (eDispatch != other.eDispatch) return eDispatch < other.eDispatch;
+				if (ziFromHash != other.ziFromHash) return ziFromHash < other.ziFromHash;
+				return ziToHash < other.ziToHash;
 			}
-			return false;
-		}
+		};
 
-		template <typename T>
-		inline bool operator<=(const T& other) const
+		struct Snapshot_t
 		{
-			return GetValue<T>() <= other;
-		}
+			unsigned long long ullLookups[(int)Dispatch_t::DISPATCH_COUNT];
+			unsigned long long ullMisses[(int)Dispatch_t::DISPATCH_COUNT];
+			unsigned long long ullAllocations;
+			unsigned long long ullAllocatedBytes;
+			unsigned long long ullDeallocations;
+			std::map<PairKey_t, PairCounters_t> mPairs; // Only pairs looked up at least once
+
+			inline Snapshot_t() noexcept
+				: ullLookups(), ullMisses(), ullAllocations(0), ullAllocatedBytes(0), ullDeallocations(0)
+			{
+			}
+		};
 
-		bool operator>(const UltaType& other) const
+		// Counters written by one thread only, relaxed loads and stores keep increments as cheap as plain ones
+		struct __ULTThreadStats_t
 		{
-			using namespace ULTCompare;
-			const auto& comp = g_UTComparers.find({m_ziTypeHash, other.m_ziTypeHash});
-			if (comp != g_UTComparers.end()) return comp->second(m_pPtr.get(), other.m_pPtr.get()) == 1;
-			return false;
-		}
+			using Counter_t = std::atomic<unsigned long long>;
+			static constexpr int g_iBaseCount = (int)ULTReflection::BaseTypes_t::TYPE_COUNT;
+			static constexpr int g_iDispatchCount = (int)Dispatch_t::DISPATCH_COUNT;
 
-		template <typename T>
-		inline bool operator>(const T& other) const
-		{
-			return GetValue<T>() > other;
-		}
+			Counter_t aAllocations{0};
+			Counter_t aAllocatedBytes{0};
+			Counter_t aDeallocations{0};
+			Counter_t aBaseHits[g_iDispatchCount][g_iBaseCount][g_iBaseCount] = {};
+			Counter_t aBaseMisses[g_iDispatchCount][g_iBaseCount][g_iBaseCount] = {};
 
-		bool operator>=(const UltaType& other) const
-		{
-			using namespace ULTCompare;
-			const auto& comp = g_UTComparers.find({m_ziTypeHash, other.m_ziTypeHash});
-			if (comp != g_UTComparers.end())
+			std::mutex mutex; // Guards mPairs, contended only while snapshot is taken
+			std::map<PairKey_t, PairCounters_t> mPairs; // Pairs with at least one type outside of BaseTypes_t
+
+			static inline void Increment(Counter_t& counter, unsigned long long n = 1) noexcept
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+			}
+
+			inline void AddTo(Snapshot_t& res)
+			{
+				res.ullAllocations += aAllocations.load(std::memory_order_relaxed);
+				res.ullAllocatedBytes += aAllocatedBytes.load(std::memory_order_relaxed);
+				res.ullDeallocations += aDeallocations.load(std::memory_order_relaxed);
+				for (int d = 0; d < g_iDispatchCount; d++)
+				{
+					for (int a = 0; a < g_iBaseCount; a++)
+					{
+						for (int b = 0; b < g_iBaseCount; b++)
+						{
+							const unsigned long long hits = aBaseHits[d][a][b].load(std::memory_order_relaxed);
+							const unsigned long long misses = aBaseMisses[d][a][b].load(std::memory_order_relaxed);
+							if (!hits && !misses) continue;
+							AddPair(res, {(Dispatch_t)d, a, GetBaseTypeHash(a), b, GetBaseTypeHash(b)}, hits, misses);
+						}
+					}
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+				for (const std::pair<const PairKey_t, PairCounters_t>& pair : mPairs)
+					AddPair(res, pair.first, pair.second.ullHits, pair.second.ullMisses);
+			}
+
+			inline void Reset()
+			{
+				aAllocations.store(0, std::memory_order_relaxed);
+				aAllocatedBytes.store(0, std::memory_order_relaxed);
+				aDeallocations.store(0, std::memory_order_relaxed);
+				for (auto& table : aBaseHits)
+					for (auto& row : table)
+						for (Counter_t& counter : row) counter.store(0, std::memory_order_relaxed);
+				for (auto& table : aBaseMisses)
+					for (auto& row : table)
+						for (Counter_t& counter : row) counter.store(0, std::memory_order_relaxed);
+
+				std::lock_guard<std::mutex> lock(mutex);
+				mPairs.clear();
+			}
+
+			static inline void AddPair(Snapshot_t& res, const PairKey_t& key, unsigned long long hits,
+									   unsigned long long misses)
+			{
+				res.ullLookups[(int)key.eDispatch] += hits + misses;
+				res.ullMisses[(int)key.eDispatch] += misses;
+				PairCounters_t& counters = res.mPairs[key];
+				counters.ullHits += hits;
+				counters.ullMisses += misses;
+			}
+
+			static inline size_t GetBaseTypeHash(int index) noexcept
+			{
+				for (const std::pair<const size_t, int>& type : ULTReflection::GetTypesIdentify())
+					if (type.second == index) return type.first;
+				return 0;
+			}
+		};
+
+		// Blocks of running threads and sum of finished ones
+		struct __ULTStatsRegistry_t
+		{
+			std::mutex mutex;
+			std::vector<__ULTThreadStats_t*> vThreads;
+			Snapshot_t finished;
+		};
+
+		inline __ULTStatsRegistry_t& __ultGetStatsRegistry()
+		{
+			static __ULTStatsRegistry_t g_Registry;
+			return g_Registry;
+		}
+
+		// Registers block of current thread, and moves its counters into registry when thread exits
+		struct __ULTThreadStatsHolder_t
+		{
+			__ULTThreadStats_t stats;
+
+			inline __ULTThreadStatsHolder_t()
+			{
+				__ULTStatsRegistry_t& registry = __ultGetStatsRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				registry.vThreads.push_back(&stats);
+			}
+
+			inline ~__ULTThreadStatsHolder_t()
+			{
+				__ULTStatsRegistry_t& registry = __ultGetStatsRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				stats.AddTo(registry.finished);
+				for (size_t i = 0; i < registry.vThreads.size(); i++)
+				{
+					if (registry.vThreads[i] != &stats) continue;
+					registry.vThreads[i] = registry.vThreads.back();
+					registry.vThreads.pop_back();
+					break;
+				}
+			}
+		};
+
+		inline __ULTThreadStats_t& __ultGetThreadStats()
+		{
+			static thread_local __ULTThreadStatsHolder_t g_Holder;
+			return g_Holder.stats;
+		}
+
+		inline void CountLookup(Dispatch_t dispatch, int aIndex, size_t aHash, int bIndex, size_t bHash, bool hit)
+		{
+			__ULTThreadStats_t& stats = __ultGetThreadStats();
+			if (ULTReflection::IsBaseType(aIndex) && ULTReflection::IsBaseType(bIndex))
+			{
+				__ULTThreadStats_t::Increment(hit ? stats.aBaseHits[(int)dispatch][aIndex][bIndex]
+												  : stats.aBaseMisses[(int)dispatch][aIndex][bIndex]);
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(stats.mutex);
+			PairCounters_t& counters = stats.mPairs[{dispatch, aIndex, aHash, bIndex, bHash}];
+			if (hit)
+				counters.ullHits++;
+			else
+				counters.ullMisses++;
+		}
+
+		inline void CountAllocation(size_t size) noexcept
+		{
+			__ULTThreadStats_t& stats = __ultGetThreadStats();
+			__ULTThreadStats_t::Increment(stats.aAllocations);
+			__ULTThreadStats_t::Increment(stats.aAllocatedBytes, size);
+		}
+
+		inline void CountDeallocation() noexcept
+		{
+			__ULTThreadStats_t::Increment(__ultGetThreadStats().aDeallocations);
+		}
+
+		// Sum over every thread. Counts of running threads may be a few increments behind.
+		inline Snapshot_t GetSnapshot()
+		{
+			__ULTStatsRegistry_t& registry = __ultGetStatsRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			Snapshot_t res = registry.finished;
+			for (__ULTThreadStats_t* stats : registry.vThreads) stats->AddTo(res);
+			return res;
+		}
+
+		// Increments racing with reset in other threads may survive it
+		inline void Reset()
+		{
+			__ULTStatsRegistry_t& registry = __ultGetStatsRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			registry.finished = Snapshot_t();
+			for (__ULTThreadStats_t* stats : registry.vThreads) stats->Reset();
+		}
+
+		inline const char* GetDispatchName(Dispatch_t dispatch) noexcept
+		{
+			static const char* const g_aNames[] = {"convert", "compare", "operator"};
+			return g_aNames[(int)dispatch];
+		}
+
+		// Base types are printed by name, other types by hash (typeid(T).hash_code())
+		inline void __ultFormatType(char (&buffer)[32], int index, size_t hash) noexcept
+		{
+			static const char* const g_aTypeNames[] = {
+				"char",		   "short",		  "int",			"long",			"long long",
+				"unsigned char", "unsigned short", "unsigned int", "unsigned long", "unsigned long long",
+				"float",	   "double",	  "long double",	"std::string"};
+			static_assert(sizeof(g_aTypeNames) / sizeof(*g_aTypeNames) ==
+							  (size_t)ULTReflection::BaseTypes_t::TYPE_COUNT,
+						  "Every base type must have a name");
+
+			if (ULTReflection::IsBaseType(index))
+				snprintf(buffer, sizeof(buffer), "%s", g_aTypeNames[index]);
+			else
+				snprintf(buffer, sizeof(buffer), "#%zx", hash);
+		}
+
+		inline void Dump(const Snapshot_t& snapshot, FILE* file = stdout)
+		{
+			fprintf(file, "allocations: %llu (%llu bytes), deallocations: %llu\n", snapshot.ullAllocations,
+					snapshot.ullAllocatedBytes, snapshot.ullDeallocations);
+			for (int d = 0; d < (int)Dispatch_t::DISPATCH_COUNT; d++)
+				fprintf(file, "%s: %llu lookups, %llu misses\n", GetDispatchName((Dispatch_t)d), snapshot.ullLookups[d],
+						snapshot.ullMisses[d]);
+
+			for (const std::pair<const PairKey_t, PairCounters_t>& pair : snapshot.mPairs)
+			{
+				const PairKey_t& key = pair.first;
+				char from[32], to[32];
+				__ultFormatType(from, key.iFromIndex, key.ziFromHash);
+				__ultFormatType(to, key.iToIndex, key.ziToHash);
+				fprintf(file, "  %s %s -> %s: %llu hits, %llu misses\n", GetDispatchName(key.eDispatch), from, to,
+						pair.second.ullHits, pair.second.ullMisses);
+			}
+		}
+
+		inline void Dump(FILE* file = stdout) { Dump(GetSnapshot(), file); }
+	} // namespace ULTStats
+#endif
+
+	namespace ULTConvert
+	{
+#ifdef __ULTATYPE_HAS_CHARCONV
+		using FromCharsResult_t = std::from_chars_result;
+		using ToCharsResult_t = std::to_chars_result;
+#else
+		struct FromCharsResult_t
+		{
+			const char* ptr;
+			std::errc ec;
+		};
+
+		struct ToCharsResult_t
+		{
+			char* ptr;
+			std::errc ec;
+		};
+#endif
+
+		// Enough for the shortest round-trip representation of any BaseTypes_t number
+		constexpr size_t g_ziMaxCharsLength = 64;
+
+#ifdef __ULTATYPE_HAS_CHARCONV
+		template <typename T>
+		inline FromCharsResult_t __ultFromChars(const char* first, const char* last, T& value,
+												std::true_type /*integral*/) noexcept
+		{
+			return std::from_chars(first, last, value);
+		}
+
+		template <typename T>
+		inline ToCharsResult_t __ultToChars(char* first, char* last, T value, std::true_type /*integral*/) noexcept
+		{
+			return std::to_chars(first, last, value);
+		}
+#else
+		template <typename T>
+		inline FromCharsResult_t __ultFromChars(const char* first, const char* last, T& value,
+												std::true_type /*integral*/) noexcept
+		{
+			const char* it = first;
+			const bool negative = std::is_signed<T>::value && it != last && *it == '-';
+			if (negative) ++it;
+
+			const unsigned long long limit = negative ? (unsigned long long)std::numeric_limits<T>::max() + 1
+													  : (unsigned long long)std::numeric_limits<T>::max();
+			const char* digits = it;
+			unsigned long long acc = 0;
+			bool overflow = false;
+			for (; it != last && *it >= '0' && *it <= '9'; ++it)
+			{
+				const unsigned digit = (unsigned)(*it - '0');
+				if (acc > (limit - digit) / 10)
+					overflow = true;
+				else
+					acc = acc * 10 + digit;
+			}
+
+			if (it == digits) return {first, std::errc::invalid_argument};
+			if (overflow) return {it, std::errc::result_out_of_range};
+			value = negative && acc ? (T)(-(long long)(acc - 1) - 1) : (T)acc;
+			return {it, std::errc()};
+		}
+
+		template <typename T>
+		inline ToCharsResult_t __ultToChars(char* first, char* last, T value, std::true_type /*integral*/) noexcept
+		{
+			char digits[24];
+			char* it = digits + sizeof(digits);
+			const bool negative = value < 0;
+			unsigned long long acc = negative ? 0ull - (unsigned long long)(long long)value : (unsigned long long)value;
+			do
+			{
+				*--it = (char)('0' + acc % 10);
+				acc /= 10;
+			} while (acc);
+			if (negative) *--it = '-';
+
+			const size_t length = (size_t)(digits + sizeof(digits) - it);
+			if ((size_t)(last - first) < length) return {last, std::errc::value_too_large};
+			memcpy(first, it, length);
+			return {first + length, std::errc()};
+		}
+#endif
+
+#if defined(__ULTATYPE_HAS_CHARCONV) && defined(__cpp_lib_to_chars)
+		template <typename T>
+		inline FromCharsResult_t __ultFromChars(const char* first, const char* last, T& value,
+												std::false_type /*floating*/) noexcept
+		{
+			return std::from_chars(first, last, value);
+		}
+
+		template <typename T>
+		inline ToCharsResult_t __ultToChars(char* first, char* last, T value, std::false_type /*floating*/) noexcept
+		{
+			return std::to_chars(first, last, value);
+		}
+#else
+		// Fallback goes through strto* and snprintf, so unlike std::from_chars it respects current C locale
+		inline double __ultStrtof(const char* str, char** end, double) { return strtod(str, end); }
+		inline long double __ultStrtof(const char* str, char** end, long double) { return strtold(str, end); }
+		inline float __ultStrtof(const char* str, char** end, float) { return strtof(str, end); }
+
+		template <typename T>
+		inline FromCharsResult_t __ultFromChars(const char* first, const char* last, T& value,
+												std::false_type /*floating*/) noexcept
+		{
+			char buffer[g_ziMaxCharsLength * 2];
+			const size_t available = (size_t)(last - first);
+			const size_t length = available < sizeof(buffer) - 1 ? available : sizeof(buffer) - 1;
+			memcpy(buffer, first, length);
+			buffer[length] = 0;
+
+			char* end = buffer;
+			const int savedErrno = errno;
+			errno = 0;
+			const T parsed = __ultStrtof(buffer, &end, T());
+			const bool outOfRange = errno == ERANGE;
+			errno = savedErrno;
+
+			if (end == buffer) return {first, std::errc::invalid_argument};
+			if (outOfRange) return {first + (end - buffer), std::errc::result_out_of_range};
+			value = parsed;
+			return {first + (end - buffer), std::errc()};
+		}
+
+		template <typename T>
+		inline ToCharsResult_t __ultToChars(char* first, char* last, T value, std::false_type /*floating*/) noexcept
+		{
+			char buffer[g_ziMaxCharsLength];
+			const int length = std::is_same<T, long double>::value
+								   ? snprintf(buffer, sizeof(buffer), "%.*Lg",
+											  std::numeric_limits<T>::max_digits10, (long double)value)
+								   : snprintf(buffer, sizeof(buffer), "%.*g",
+											  std::numeric_limits<T>::max_digits10, (double)value);
+			if (length < 0 || (size_t)(last - first) < (size_t)length) return {last, std::errc::value_too_large};
+			memcpy(first, buffer, (size_t)length);
+			return {first + length, std::errc()};
+		}
+#endif
+
+		// Parses number like std::from_chars does, but also skips leading whitespace and '+' as std::sto* did.
+		// value is left untouched on error.
+		template <typename T>
+		inline FromCharsResult_t FromChars(const char* first, const char* last, T& value) noexcept
+		{
+			static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+						  "FromChars expects a number");
+
+			const char* it = first;
+			while (it != last && (*it == ' ' || (*it >= '\t' && *it <= '\r')))
+				++it;
+			if (it != last && *it == '+' && it + 1 != last && it[1] != '-') ++it;
+
+			FromCharsResult_t res = __ultFromChars(it, last, value, std::is_integral<T>());
+			if (res.ec == std::errc::invalid_argument) res.ptr = first;
+			return res;
+		}
+
+		// Writes shortest representation that round-trips back to the same value, without terminating zero
+		template <typename T>
+		inline ToCharsResult_t ToChars(char* first, char* last, T value) noexcept
+		{
+			static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+						  "ToChars expects a number");
+			return __ultToChars(first, last, value, std::is_integral<T>());
+		}
+
+		// Throwing conversion from string, kept for std::sto* compatible error reporting
+		struct FromString_t
+		{
+		private:
+			const std::string& source;
+
+			template <typename T>
+			inline T Parse() const
+			{
+				T value = T();
+				const FromCharsResult_t res = FromChars(source.data(), source.data() + source.size(), value);
+				if (res.ec == std::errc::invalid_argument) throw std::invalid_argument("ULT::FromString_t");
+				if (res.ec == std::errc::result_out_of_range) throw std::out_of_range("ULT::FromString_t");
+				return value;
+			}
+
+		public:
+			FromString_t(const std::string& src) : source(src) {}
+
+			inline operator char() const { return Parse<char>(); }
+			inline operator short() const { return Parse<short>(); }
+			inline operator int() const { return Parse<int>(); }
+			inline operator long() const { return Parse<long>(); }
+			inline operator long long() const { return Parse<long long>(); }
+
+			inline operator unsigned char() const { return Parse<unsigned char>(); }
+			inline operator unsigned short() const { return Parse<unsigned short>(); }
+			inline operator unsigned int() const { return Parse<unsigned int>(); }
+			inline operator unsigned long() const { return Parse<unsigned long>(); }
+			inline operator unsigned long long() const { return Parse<unsigned long long>(); }
+
+			inline operator float() const { return Parse<float>(); }
+			inline operator double() const { return Parse<double>(); }
+			inline operator long double() const { return Parse<long double>(); }
+		};
+
+		template <typename S, typename T>
+		inline void __utBaseConverter(const void* a, const void* dst)
+		{
+			const S& val = *(S*)a;
+			*(T*)dst = static_cast<T>(val);
+		}
+
+		// Reuses destination capacity, so converting into the same string again doesn't allocate
+		template <typename S>
+		inline void __ultToStringConverter(const void* a, const void* dst /*std::string*/)
+		{
+			char buffer[g_ziMaxCharsLength];
+			const ToCharsResult_t res = ToChars(buffer, buffer + sizeof(buffer), *(const S*)a);
+			((std::string*)dst)->assign(buffer, res.ptr);
+		}
+
+		// Malformed or out of range string gives T()
+		template <typename T>
+		inline void __ultFromStringConverter(const void* a /*std::string*/, const void* dst)
+		{
+			const std::string& val = *(std::string*)a;
+			T& out = *(T*)dst;
+			if (FromChars(val.data(), val.data() + val.size(), out).ec != std::errc()) out = T();
+		}
+
+		using Converter_t = void (*)(const void* src, const void* dst);
+
+		template <typename S, typename T, typename = void>
+		struct __ULTConverterFor_t
+		{
+			static constexpr Converter_t value = nullptr;
+		};
+
+		template <typename S, typename T>
+		struct __ULTConverterFor_t<
+			S, T, typename std::enable_if<std::is_arithmetic<S>::value && std::is_arithmetic<T>::value>::type>
+		{
+			static constexpr Converter_t value = __utBaseConverter<S, T>;
+		};
+
+		template <typename S>
+		struct __ULTConverterFor_t<S, std::string, typename std::enable_if<std::is_arithmetic<S>::value>::type>
+		{
+			static constexpr Converter_t value = __ultToStringConverter<S>;
+		};
+
+		template <typename T>
+		struct __ULTConverterFor_t<std::string, T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+		{
+			static constexpr Converter_t value = __ultFromStringConverter<T>;
+		};
+
+		using DenseConverters_t =
+			ULTReflection::DenseTable_t<__ULTConverterFor_t, Converter_t, ULTReflection::BaseTypesList_t>;
+
+		// Converters between types outside of BaseTypes_t, see ULT::RegisterConverter.
+		// Shared by every translation unit and constructed on first use.
+		inline ULTReflection::TypePairRegistry_t<Converter_t>& GetConverters()
+		{
+			static ULTReflection::TypePairRegistry_t<Converter_t> g_UTConverters;
+			return g_UTConverters;
+		}
+
+		inline Converter_t FindConverter(int fromIndex, size_t fromHash, int toIndex, size_t toHash)
+		{
+			Converter_t res;
+			if (ULTReflection::IsBaseType(fromIndex) && ULTReflection::IsBaseType(toIndex))
+				res = DenseConverters_t::Get(fromIndex, toIndex);
+			else
+			{
+				const Converter_t* conv = GetConverters().Find(fromHash, toHash);
+				res = conv ? *conv : nullptr;
+			}
+			__ULTATYPE_STAT(ULTStats::CountLookup(ULTStats::Dispatch_t::DISPATCH_CONVERT, fromIndex, fromHash, toIndex,
+												  toHash, res != nullptr));
+			return res;
+		}
+
+		template <typename T>
+		using __ULTIsNumber_t =
+			std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+
+		template <typename T>
+		inline bool __ultParse(const void* src /*std::string*/, T& out, std::true_type /*number*/) noexcept
+		{
+			const std::string& str = *(const std::string*)src;
+			return FromChars(str.data(), str.data() + str.size(), out).ec == std::errc();
+		}
+
+		template <typename T>
+		inline bool __ultParse(const void*, T&, std::false_type /*number*/) noexcept
+		{
+			return false;
+		}
+
+		// Calls conv found for fromIndex -> T, but parses strings to numbers itself, so malformed or
+		// out of range text gives false and leaves out untouched instead of T()
+		template <typename T>
+		inline bool __ultTryConvert(Converter_t conv, int fromIndex, const void* src, T& out)
+		{
+			if (__ULTIsNumber_t<T>::value && fromIndex == (int)ULTReflection::BaseTypes_t::TYPE_STDSTRING)
+				return __ultParse(src, out, __ULTIsNumber_t<T>());
+			conv(src, (void*)&out);
+			return true;
+		}
+	} // namespace ULTConvert
+
+	namespace ULTCompare
+	{
+		template <typename T1, typename T2>
+		inline const char __ultCompareValues(const T1& aT, const T2& bT, std::integral_constant<int, 0> /*same kind*/)
+		{
+#pragma warning(push)
+#pragma warning(disable : 4018)
+			if (aT < bT)
+				return -1;
+			else if (aT == bT)
+				return 0;
+			else /*if (aT > bT)*/
+				return 1;
+#pragma warning(pop)
+		}
+
+		template <typename T>
+		inline bool __ultIsNegative(T value, std::true_type /*signed*/)
+		{
+			return value < 0;
+		}
+
+		template <typename T>
+		inline bool __ultIsNegative(T, std::false_type /*signed*/)
+		{
+			return false;
+		}
+
+		// Integers of different signedness, -1 < 0u instead of converting -1 to unsigned
+		template <typename T1, typename T2>
+		inline const char __ultCompareValues(const T1& aT, const T2& bT, std::integral_constant<int, 1> /*signedness*/)
+		{
+			if (__ultIsNegative(aT, std::is_signed<T1>())) return -1;
+			if (__ultIsNegative(bT, std::is_signed<T2>())) return 1;
+			return __ultCompareValues((unsigned long long)aT, (unsigned long long)bT, std::integral_constant<int, 0>());
+		}
+
+		// Floating point and another number, compared in long double so integers aren't rounded to float
+		template <typename T1, typename T2>
+		inline const char __ultCompareValues(const T1& aT, const T2& bT, std::integral_constant<int, 2> /*floating*/)
+		{
+			return __ultCompareValues((long double)aT, (long double)bT, std::integral_constant<int, 0>());
+		}
+
+		template <typename T1, typename T2>
+		using __ULTCompareKind_t = std::integral_constant<
+			int, std::is_same<T1, T2>::value || !std::is_arithmetic<T1>::value || !std::is_arithmetic<T2>::value
+					 ? 0
+					 : (std::is_floating_point<T1>::value || std::is_floating_point<T2>::value
+							? 2
+							: (std::is_signed<T1>::value != std::is_signed<T2>::value ? 1 : 0))>;
+
+		// Numbers are compared by their values, without usual arithmetic conversions
+		template <typename T1, typename T2>
+		inline const char __ultBaseComparer(const void* a, const void* b)
+		{
+			return __ultCompareValues(*(const T1*)a, *(const T2*)b, __ULTCompareKind_t<T1, T2>());
+		}
+
+		using Comparer_t = const char (*)(const void* a, const void* b);
+
+		template <typename A, typename B, typename = void>
+		struct __ULTComparerFor_t
+		{
+			static constexpr Comparer_t value = nullptr;
+		};
+
+		template <typename A, typename B>
+		struct __ULTComparerFor_t<
+			A, B, typename std::enable_if<std::is_arithmetic<A>::value && std::is_arithmetic<B>::value>::type>
+		{
+			static constexpr Comparer_t value = __ultBaseComparer<A, B>;
+		};
+
+		template <>
+		struct __ULTComparerFor_t<std::string, std::string>
+		{
+			static constexpr Comparer_t value = __ultBaseComparer<std::string, std::string>;
+		};
+
+		using DenseComparers_t =
+			ULTReflection::DenseTable_t<__ULTComparerFor_t, Comparer_t, ULTReflection::BaseTypesList_t>;
+
+		// Comparers between types outside of BaseTypes_t, see ULT::RegisterComparer.
+		// Shared by every translation unit and constructed on first use.
+		inline ULTReflection::TypePairRegistry_t<Comparer_t>& GetComparers()
+		{
+			static ULTReflection::TypePairRegistry_t<Comparer_t> g_UTComparers;
+			return g_UTComparers;
+		}
+
+		inline Comparer_t FindComparer(int aIndex, size_t aHash, int bIndex, size_t bHash)
+		{
+			Comparer_t res;
+			if (ULTReflection::IsBaseType(aIndex) && ULTReflection::IsBaseType(bIndex))
+				res = DenseComparers_t::Get(aIndex, bIndex);
+			else
+			{
+				const Comparer_t* comp = GetComparers().Find(aHash, bHash);
+				res = comp ? *comp : nullptr;
+			}
+			__ULTATYPE_STAT(ULTStats::CountLookup(ULTStats::Dispatch_t::DISPATCH_COMPARE, aIndex, aHash, bIndex, bHash,
+												  res != nullptr));
+			return res;
+		}
+	} // namespace ULTCompare
+
+	namespace ULTOperations
+	{
+		using Operator_t = void (*)(const void* a, const void* b, void* result);
+
+		struct OperatorFns_t
+		{
+			Operator_t Plus;
+			Operator_t Minus;
+			Operator_t Multiply;
+			Operator_t Divide;
+		};
+
+#pragma warning(push)
+#pragma warning(disable : 4244)
+		template <typename A, typename B>
+		struct __ULTBaseTOperator_t
+		{
+			static void Plus(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			{
+				const A& aA = *(A*)a;
+				const B& bB = *(B*)b;
+				*(A*)result = aA + bB;
+			}
+
+			static void Minus(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			{
+				const A& aA = *(A*)a;
+				const B& bB = *(B*)b;
+				*(A*)result = aA - bB;
+			}
+
+			static void Multiply(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			{
+				const A& aA = *(A*)a;
+				const B& bB = *(B*)b;
+				*(A*)result = aA * bB;
+			}
+
+			static void Divide(const void* /*A*/ a, const void* /*B*/ b, void* /*A*/ result)
+			{
+				const A& aA = *(A*)a;
+				const B& bB = *(B*)b;
+				*(A*)result = aA / bB;
+			}
+		};
+#pragma warning(pop)
+
+		template <typename A, typename B, typename = void>
+		struct __ULTOperatorFor_t
+		{
+			static constexpr OperatorFns_t value = {nullptr, nullptr, nullptr, nullptr};
+		};
+
+		template <typename A, typename B>
+		struct __ULTOperatorFor_t<
+			A, B, typename std::enable_if<std::is_arithmetic<A>::value && std::is_arithmetic<B>::value>::type>
+		{
+			static constexpr OperatorFns_t value = {__ULTBaseTOperator_t<A, B>::Plus, __ULTBaseTOperator_t<A, B>::Minus,
+													__ULTBaseTOperator_t<A, B>::Multiply,
+													__ULTBaseTOperator_t<A, B>::Divide};
+		};
+
+		using DenseOperators_t =
+			ULTReflection::DenseTable_t<__ULTOperatorFor_t, OperatorFns_t, ULTReflection::BaseTypesList_t>;
+
+		// Operators between types outside of BaseTypes_t, see ULT::RegisterOperators.
+		// Shared by every translation unit and constructed on first use.
+		inline ULTReflection::TypePairRegistry_t<OperatorFns_t>& GetOperators()
+		{
+			static ULTReflection::TypePairRegistry_t<OperatorFns_t> g_Operators;
+			return g_Operators;
+		}
+
+		inline const OperatorFns_t* FindOperators(int aIndex, size_t aHash, int bIndex, size_t bHash)
+		{
+			const OperatorFns_t* res;
+			if (ULTReflection::IsBaseType(aIndex) && ULTReflection::IsBaseType(bIndex))
+			{
+				const OperatorFns_t& fns = DenseOperators_t::Get(aIndex, bIndex);
+				res = fns.Plus ? &fns : nullptr;
+			}
+			else
+				res = GetOperators().Find(aHash, bHash);
+			__ULTATYPE_STAT(ULTStats::CountLookup(ULTStats::Dispatch_t::DISPATCH_OPERATOR, aIndex, aHash, bIndex, bHash,
+												  res != nullptr));
+			return res;
+		}
+
+		enum class Operation_t : int
+		{
+			OPERATION_PLUS,
+			OPERATION_MINUS,
+			OPERATION_MULTIPLY,
+			OPERATION_DIVIDE,
+		};
+
+		inline Operator_t SelectOperator(const OperatorFns_t& fns, Operation_t op) noexcept
+		{
+			switch (op)
+			{
+			case Operation_t::OPERATION_PLUS:
+				return fns.Plus;
+			case Operation_t::OPERATION_MINUS:
+				return fns.Minus;
+			case Operation_t::OPERATION_MULTIPLY:
+				return fns.Multiply;
+			default:
+				return fns.Divide;
+			}
+		}
+
+		// Remembers operator for last seen type pair, so runs of equal pairs are dispatched once
+		struct OperatorCache_t
+		{
+			size_t ziAHash = 0;
+			size_t ziBHash = 0;
+			Operator_t fn = nullptr;
+			bool bResolved = false;
+
+			inline Operator_t Get(Operation_t op, int aIndex, size_t aHash, int bIndex, size_t bHash)
+			{
+				if (bResolved && aHash == ziAHash && bHash == ziBHash) return fn;
+
+				const OperatorFns_t* fns = FindOperators(aIndex, aHash, bIndex, bHash);
+				fn = fns ? SelectOperator(*fns, op) : nullptr;
+				ziAHash = aHash;
+				ziBHash = bHash;
+				bResolved = true;
+				return fn;
+			}
+		};
+
+		// Batch versions work on n values at once: result[i] = a[i] op b[i]. result may be the same
+		// array as a, other overlaps fall back to scalar loop. Loops are written to be vectorized
+		// by compiler (-O3), on GCC/x86-64 there's also AVX2 clone chosen at runtime.
+		using BatchOperator_t = void (*)(const void* a, const void* b, void* result, size_t n);
+
+		struct BatchOperatorFns_t
+		{
+			BatchOperator_t PlusN;
+			BatchOperator_t MinusN;
+			BatchOperator_t MultiplyN;
+			BatchOperator_t DivideN;
+		};
+
+#pragma warning(push)
+#pragma warning(disable : 4244)
+		struct __ULTPlus_t
+		{
+			template <typename A, typename B>
+			static inline A Apply(A a, B b) { return a + b; }
+		};
+
+		struct __ULTMinus_t
+		{
+			template <typename A, typename B>
+			static inline A Apply(A a, B b) { return a - b; }
+		};
+
+		struct __ULTMultiply_t
+		{
+			template <typename A, typename B>
+			static inline A Apply(A a, B b) { return a * b; }
+		};
+
+		struct __ULTDivide_t
+		{
+			template <typename A, typename B>
+			static inline A Apply(A a, B b) { return a / b; }
+		};
+
+		template <typename A, typename B>
+		struct __ULTBatchTOperator_t
+		{
+			template <typename Op>
+			__ULTATYPE_BATCH_KERNEL static void Run(const A* __restrict a, const B* __restrict b, A* __restrict result,
+													size_t n)
+			{
+				for (size_t i = 0; i < n; i++)
+					result[i] = Op::Apply(a[i], b[i]);
+			}
+
+			template <typename Op>
+			__ULTATYPE_BATCH_KERNEL static void RunInPlace(A* __restrict a, const B* __restrict b, size_t n)
+			{
+				for (size_t i = 0; i < n; i++)
+					a[i] = Op::Apply(a[i], b[i]);
+			}
+
+			template <typename Op>
+			static void RunN(const void* a, const void* b, void* result, size_t n)
+			{
+				const A* aA = (const A*)a;
+				const B* bB = (const B*)b;
+				A* res = (A*)result;
+				const char* resBegin = (const char*)res;
+				const char* resEnd = (const char*)(res + n);
+				const bool bOverlaps = (const char*)(bB + n) > resBegin && (const char*)bB < resEnd;
+
+				if (res == aA && !bOverlaps)
+					RunInPlace<Op>(res, bB, n);
+				else if (!bOverlaps && ((const char*)(aA + n) <= resBegin || (const char*)aA >= resEnd))
+					Run<Op>(aA, bB, res, n);
+				else
+					for (size_t i = 0; i < n; i++)
+						res[i] = Op::Apply(aA[i], bB[i]);
+			}
+
+			static void PlusN(const void* a, const void* b, void* result, size_t n)
+			{
+				RunN<__ULTPlus_t>(a, b, result, n);
+			}
+			static void MinusN(const void* a, const void* b, void* result, size_t n)
+			{
+				RunN<__ULTMinus_t>(a, b, result, n);
+			}
+			static void MultiplyN(const void* a, const void* b, void* result, size_t n)
+			{
+				RunN<__ULTMultiply_t>(a, b, result, n);
+			}
+			static void DivideN(const void* a, const void* b, void* result, size_t n)
+			{
+				RunN<__ULTDivide_t>(a, b, result, n);
+			}
+		};
+#pragma warning(pop)
+
+		template <typename A, typename B, typename = void>
+		struct __ULTBatchOperatorFor_t
+		{
+			static constexpr BatchOperatorFns_t value = {nullptr, nullptr, nullptr, nullptr};
+		};
+
+		template <typename A, typename B>
+		struct __ULTBatchOperatorFor_t<
+			A, B, typename std::enable_if<std::is_arithmetic<A>::value && std::is_arithmetic<B>::value>::type>
+		{
+			static constexpr BatchOperatorFns_t value = {
+				__ULTBatchTOperator_t<A, B>::PlusN, __ULTBatchTOperator_t<A, B>::MinusN,
+				__ULTBatchTOperator_t<A, B>::MultiplyN, __ULTBatchTOperator_t<A, B>::DivideN};
+		};
+
+		using DenseBatchOperators_t =
+			ULTReflection::DenseTable_t<__ULTBatchOperatorFor_t, BatchOperatorFns_t, ULTReflection::BaseTypesList_t>;
+
+		// Batch operators exist only for BaseTypes_t pairs, other types go through FindOperators per element
+		inline const BatchOperatorFns_t* FindBatchOperators(int aIndex, int bIndex) noexcept
+		{
+			if (!ULTReflection::IsBaseType(aIndex) || !ULTReflection::IsBaseType(bIndex)) return nullptr;
+
+			const BatchOperatorFns_t& fns = DenseBatchOperators_t::Get(aIndex, bIndex);
+			return fns.PlusN ? &fns : nullptr;
+		}
+
+		inline BatchOperator_t SelectBatchOperator(const BatchOperatorFns_t& fns, Operation_t op) noexcept
+		{
+			switch (op)
+			{
+			case Operation_t::OPERATION_PLUS:
+				return fns.PlusN;
+			case Operation_t::OPERATION_MINUS:
+				return fns.MinusN;
+			case Operation_t::OPERATION_MULTIPLY:
+				return fns.MultiplyN;
+			default:
+				return fns.DivideN;
+			}
+		}
+	} // namespace ULTOperations
+
+	// Registration of converters, comparers and operators for user types. Pairs where both types are
+	// BaseTypes_t are served by dense tables and can't be overridden. Register before values are
+	// used from several threads, registries are not synchronized.
+
+	template <typename From, typename To>
+	inline void RegisterConverter(ULTConvert::Converter_t converter)
+	{
+		static_assert(ULTReflection::TypeIndex_t<From>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN ||
+						  ULTReflection::TypeIndex_t<To>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN,
+					  "Converters between base types are built in");
+		ULTConvert::GetConverters().Insert(typeid(From).hash_code(), typeid(To).hash_code(), converter);
+	}
+
+	// Converts with static_cast<To>
+	template <typename From, typename To>
+	inline void RegisterConverter()
+	{
+		RegisterConverter<From, To>(ULTConvert::__utBaseConverter<From, To>);
+	}
+
+	template <typename A, typename B>
+	inline void RegisterComparer(ULTCompare::Comparer_t comparer)
+	{
+		static_assert(ULTReflection::TypeIndex_t<A>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN ||
+						  ULTReflection::TypeIndex_t<B>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN,
+					  "Comparers between base types are built in");
+		ULTCompare::GetComparers().Insert(typeid(A).hash_code(), typeid(B).hash_code(), comparer);
+	}
+
+	// Compares with operator< and operator==
+	template <typename A, typename B>
+	inline void RegisterComparer()
+	{
+		RegisterComparer<A, B>(ULTCompare::__ultBaseComparer<A, B>);
+	}
+
+	template <typename A, typename B>
+	inline void RegisterOperators(const ULTOperations::OperatorFns_t& operators)
+	{
+		static_assert(ULTReflection::TypeIndex_t<A>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN ||
+						  ULTReflection::TypeIndex_t<B>::value == ULTReflection::BaseTypes_t::TYPE_UNKNOWN,
+					  "Operators between base types are built in");
+		ULTOperations::GetOperators().Insert(typeid(A).hash_code(), typeid(B).hash_code(), operators);
+	}
+
+	// Uses A's operators +, -, *, / with B, result is stored as A
+	template <typename A, typename B>
+	inline void RegisterOperators()
+	{
+		using Op = ULTOperations::__ULTBaseTOperator_t<A, B>;
+		RegisterOperators<A, B>({Op::Plus, Op::Minus, Op::Multiply, Op::Divide});
+	}
+
+	namespace ULTMemory
+	{
+		// Source of payload blocks for values that don't fit inside UltaType
+		class MemoryResource_t
+		{
+		public:
+			virtual ~MemoryResource_t() = default;
+
+			virtual void* Allocate(size_t size, size_t align) = 0;
+			virtual void Deallocate(void* ptr, size_t size, size_t align) noexcept = 0;
+		};
+
+		// nullptr resource means global operator new/delete
+		inline void* Allocate(MemoryResource_t* resource, size_t size, size_t align)
+		{
+			if (resource) return resource->Allocate(size, align);
+#if __cplusplus >= 201703L
+			if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator new(size, std::align_val_t(align));
+#endif
+			return ::operator new(size);
+		}
+
+		inline void Deallocate(MemoryResource_t* resource, void* ptr, size_t size, size_t align) noexcept
+		{
+			if (resource) return resource->Deallocate(ptr, size, align);
+#if __cplusplus >= 201703L
+			if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator delete(ptr, std::align_val_t(align));
+#endif
+			::operator delete(ptr);
+		}
+
+		// Bump pointer arena. Deallocate does nothing, memory is given back all at once by Release
+		// or destructor, so dropping many values is as cheap as dropping a few chunks.
+		// Values allocated from arena must be destroyed (or never used again) before that,
+		// shared payloads (see ULTReflection::SharesPayload_t) are always touched when dropped, so destroy those.
+		class ArenaResource_t final : public MemoryResource_t
+		{
+		private:
+			struct Chunk_t
+			{
+				Chunk_t* pNext;
+				size_t ziSize;
+			};
+
+		public:
+			inline explicit ArenaResource_t(size_t chunkSize = ULTATYPE_ARENA_CHUNK_SIZE,
+											MemoryResource_t* upstream = nullptr) noexcept
+				: m_pUpstream(upstream), m_pChunks(nullptr), m_pCur(nullptr), m_pEnd(nullptr),
+				  m_ziNextChunk(chunkSize ? chunkSize : ULTATYPE_ARENA_CHUNK_SIZE)
+			{
+			}
+			ArenaResource_t(const ArenaResource_t&) = delete;
+			ArenaResource_t& operator=(const ArenaResource_t&) = delete;
+			inline ~ArenaResource_t() { Release(); }
+
+			inline void* Allocate(size_t size, size_t align) override
+			{
+				unsigned char* ptr = AlignUp(m_pCur, align);
+				if (!m_pCur || ptr + size > m_pEnd)
+				{
+					Grow(size + align);
+					ptr = AlignUp(m_pCur, align);
+				}
+				m_pCur = ptr + size;
+				return ptr;
+			}
+
+			inline void Deallocate(void*, size_t, size_t) noexcept override {}
+
+			// Gives every chunk back to upstream
+			inline void Release() noexcept
+			{
+				while (m_pChunks)
+				{
+					Chunk_t* next = m_pChunks->pNext;
+					ULTMemory::Deallocate(m_pUpstream, m_pChunks, m_pChunks->ziSize, alignof(std::max_align_t));
+					m_pChunks = next;
+				}
+				m_pCur = nullptr;
+				m_pEnd = nullptr;
+			}
+
+		private:
+			static inline unsigned char* AlignUp(unsigned char* ptr, size_t align) noexcept
+			{
+				return (unsigned char*)(((uintptr_t)ptr + align - 1) & ~(uintptr_t)(align - 1));
+			}
+
+			// Chunks grow twice each time, like std::pmr::monotonic_buffer_resource does
+			inline void Grow(size_t atLeast)
+			{
+				const size_t header = (sizeof(Chunk_t) + alignof(std::max_align_t) - 1) &
+									  ~(alignof(std::max_align_t) - 1);
+				size_t size = m_ziNextChunk;
+				while (size < header + atLeast) size *= 2;
+
+				Chunk_t* chunk = (Chunk_t*)ULTMemory::Allocate(m_pUpstream, size, alignof(std::max_align_t));
+				chunk->pNext = m_pChunks;
+				chunk->ziSize = size;
+				m_pChunks = chunk;
+				m_pCur = (unsigned char*)chunk + header;
+				m_pEnd = (unsigned char*)chunk + size;
+				m_ziNextChunk = size * 2;
+			}
+
+		private:
+			MemoryResource_t* m_pUpstream;
+			Chunk_t* m_pChunks;
+			unsigned char* m_pCur;
+			unsigned char* m_pEnd;
+			size_t m_ziNextChunk;
+		};
+
+#ifdef __ULTATYPE_HAS_MEMORY_RESOURCE
+		// Lets std::pmr resources (monotonic_buffer_resource, pools...) provide payloads
+		class PmrResource_t final : public MemoryResource_t
+		{
+		public:
+			inline explicit PmrResource_t(
+				std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept
+				: m_pResource(resource)
+			{
+			}
+
+			inline void* Allocate(size_t size, size_t align) override { return m_pResource->allocate(size, align); }
+			inline void Deallocate(void* ptr, size_t size, size_t align) noexcept override
+			{
+				m_pResource->deallocate(ptr, size, align);
+			}
+
+			inline std::pmr::memory_resource* GetResource() const noexcept { return m_pResource; }
+
+		private:
+			std::pmr::memory_resource* m_pResource;
+		};
+#endif
+
+#ifdef ULTATYPE_SHARED_PAYLOADS
+		// Lies right before shared payload, so payload pointer stays the same as for not shared blocks
+		struct __ULTSharedHeader_t
+		{
+			std::atomic<size_t> aRefs;
+		};
+
+		inline size_t __ultSharedAlign(size_t align) noexcept
+		{
+			return align > alignof(__ULTSharedHeader_t) ? align : alignof(__ULTSharedHeader_t);
+		}
+
+		// Distance from block start to payload
+		inline size_t __ultSharedOffset(size_t align) noexcept
+		{
+			const size_t blockAlign = __ultSharedAlign(align);
+			return (sizeof(__ULTSharedHeader_t) + blockAlign - 1) / blockAlign * blockAlign;
+		}
+
+		inline __ULTSharedHeader_t* __ultSharedHeader(void* payload) noexcept
+		{
+			return (__ULTSharedHeader_t*)((unsigned char*)payload - sizeof(__ULTSharedHeader_t));
+		}
+#endif
+	} // namespace ULTMemory
+
+	namespace ULTExpression
+	{
+		// Base of lazily evaluated arithmetic expressions, see ULT::Lazy
+		struct Expression_t
+		{
+		};
+
+		template <typename T>
+		using __ULTIsExpression_t = std::is_base_of<Expression_t, T>;
+	} // namespace ULTExpression
+
+	namespace ULTVariant
+	{
+		// Base of UltaTypeOf and UltaScalar (see ultatypeof.hpp, ultascalar.hpp),
+		// they become UltaType through their own conversion operators
+		struct ClosedVariant_t
+		{
+		};
+
+		template <typename T>
+		using __ULTIsClosedVariant_t = std::is_base_of<ClosedVariant_t, T>;
+	} // namespace ULTVariant
+
+	class UltaTypeView;
+
+	class UltaType final
+	{
+	private:
+#ifndef ULTATYPE_BYTE_TYPE
+#if __cplusplus >= 201703L
+		using UltaTypeByte_t = std::byte;
+#else
+		using UltaTypeByte_t = unsigned char;
+#endif
+#else
+		using UltaTypeByte_t = ULTATYPE_BYTE_TYPE;
+#endif
+
+#ifdef ULTATYPE_SAVE_TYPENAME
+#if __cplusplus >= 201703L
+		using UltaTypeName_t = std::string_view;
+#else
+		using UltaTypeName_t = const std::string&;
+#endif
+#endif
+
+		static_assert(sizeof(UltaTypeByte_t) == 1,
+					  "Can't recognize byte type! Please, define it manualy with ULTATYPE_BYTE_TYPE=<byteType> macro");
+		static_assert(ULTATYPE_INLINE_SIZE >= sizeof(void*), "ULTATYPE_INLINE_SIZE is too small");
+
+		friend class UltaTypeView;
+
+	public:
+		inline UltaType() : m_ziTypeHash(0), m_pResource(nullptr), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+		}
+		template <typename T, typename = typename std::enable_if<
+								  !std::is_convertible<const T&, ULTMemory::MemoryResource_t*>::value &&
+								  !ULTExpression::__ULTIsExpression_t<T>::value &&
+								  !ULTVariant::__ULTIsClosedVariant_t<T>::value>::type>
+		inline UltaType(const T& value)
+			: m_ziTypeHash(0), m_pResource(nullptr), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+			SetValue<T>(value);
+		}
+
+		// Evaluates expression built with ULT::Lazy
+		template <typename E, typename std::enable_if<ULTExpression::__ULTIsExpression_t<E>::value, int>::type = 0>
+		inline UltaType(const E& expression)
+			: m_ziTypeHash(0), m_pResource(nullptr), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+			expression.Assign(*this);
+		}
+
+		// Values that don't fit inside are allocated from resource, which must outlive this UltaType.
+		// Resource is kept by assignments and taken over by move construction, copies use the global heap.
+		inline explicit UltaType(ULTMemory::MemoryResource_t* resource) noexcept
+			: m_ziTypeHash(0), m_pResource(resource), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+		}
+		template <typename T>
+		inline UltaType(const T& value, ULTMemory::MemoryResource_t* resource)
+			: m_ziTypeHash(0), m_pResource(resource), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+			SetValue<T>(value);
+		}
+
+		inline void Copy(const UltaType& other)
+		{
+			if (this == &other) return;
+
+			if (other.CanShare(m_pResource))
+			{
+				if (m_pPtr == other.m_pPtr) return;
+				AddRef(other.m_pPtr); // Before Reset, which may drop the last other reference
+				Reset();
+				m_pPtr = other.m_pPtr;
+				m_ziTypeHash = other.m_ziTypeHash;
+				m_pOps = other.m_pOps;
+				m_iTypeIndex = other.m_iTypeIndex;
+				return;
+			}
+
+			if (m_pOps && m_pOps == other.m_pOps && !IsShared())
+			{
+				if (m_pOps->bTrivial)
+					memcpy(GetData(), other.GetData(), m_pOps->ziSize);
+				else
+					m_pOps->CopyAssign(other.GetData(), GetData());
+				return;
+			}
+
+			Reset();
+			if (!other.m_pOps) return;
+
+			ConstructFrom(other.m_pOps, other.GetData());
+			m_ziTypeHash = other.m_ziTypeHash;
+			m_pOps = other.m_pOps;
+			m_iTypeIndex = other.m_iTypeIndex;
+		}
+
+		// Payload block is taken over if both use the same resource,
+		// otherwise the value is moved (copied if block is shared) into a block of this resource
+		inline void Move(UltaType& other)
+		{
+			if (this == &other) return;
+
+			Reset();
+			if (!other.m_pOps) return;
+
+			const ULTReflection::TypeOps_t* ops = other.m_pOps;
+			if (other.m_pPtr && other.m_pResource == m_pResource)
+			{
+				m_pPtr = other.m_pPtr;
+				other.m_pPtr = nullptr;
+				other.m_pOps = nullptr; // Nothing left to destroy
+			}
+			else if (other.m_pPtr)
+			{
+				UltaTypeByte_t* block = AllocateBlock(ops);
+				if (other.IsShared())
+				{
+					try
+					{
+						CopyPayload(ops, other.m_pPtr, block);
+					}
+					catch (...)
+					{
+						DeallocateBlock(block, ops);
+						throw;
+					}
+				}
+				else
+					ops->MoveConstruct(other.m_pPtr, block);
+				m_pPtr = block;
+			}
+			else if (ops->bTrivial)
+				memcpy(m_aInlineBuf, other.m_aInlineBuf, ops->ziSize);
+			else
+				ops->MoveConstruct(other.m_aInlineBuf, m_aInlineBuf);
+
+			m_ziTypeHash = other.m_ziTypeHash;
+			m_pOps = ops;
+			m_iTypeIndex = other.m_iTypeIndex;
+			other.Reset();
+		}
+
+		inline UltaType(const UltaType& other)
+			: m_ziTypeHash(0), m_pResource(nullptr), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+			Copy(other);
+		}
+		inline UltaType(UltaType&& other) noexcept
+			: m_ziTypeHash(0), m_pResource(other.m_pResource), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+		{
+			Move(other); // Same resource, never allocates
+		}
+		inline UltaType(const UltaTypeView& view);
+		inline UltaType& operator=(const UltaType& other)
+		{
+			Copy(other);
+			return *this;
+		}
+		// Not noexcept: if resources differ, value is moved into a block of this resource, which may fail to allocate.
+		// Same resource (e.g. both on the global heap) never allocates.
+		inline UltaType& operator=(UltaType&& other)
+		{
+			Move(other);
+			return *this;
+		}
+		inline UltaType& operator=(const UltaTypeView& view);
+		inline ~UltaType() { Reset(); }
+
+		// Destroys stored value, leaving UltaType empty. Shared payload is destroyed by its last owner.
+		inline void Reset() noexcept
+		{
+			if (m_pOps && Release())
+			{
+				if (!m_pOps->bTrivial) m_pOps->Destroy(GetData());
+				if (m_pPtr) DeallocateBlock(m_pPtr, m_pOps);
+			}
+			m_pPtr = nullptr;
+			m_ziTypeHash = 0;
+			m_pOps = nullptr;
+			m_iTypeIndex = -1;
+		}
+
+		template <typename T, typename std::enable_if<!std::is_array<T>::value, int>::type = 0>
+		void SetValue(const T& value)
+		{
+			const size_t newHash = typeid(value).hash_code();
+			if (newHash == m_ziTypeHash && !IsShared())
+			{
+				*(T*)GetData() = value;
+				return;
+			}
+
+			Emplace<T>(value, ULTReflection::StoresInline_t<T>());
+			m_ziTypeHash = newHash;
+			m_pOps = ULTReflection::GetTypeOps<T>();
+			m_iTypeIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+		}
+
+		// String literal is stored as std::string
+		template <typename T, typename std::enable_if<std::is_array<T>::value, int>::type = 0>
+		inline void SetValue(const T& value)
+		{
+			SetValue<std::string>(ULTReflection::__ultArrayString(value));
+		}
+
+		// Result is written right into this value's storage
+		template <typename E, typename std::enable_if<ULTExpression::__ULTIsExpression_t<E>::value, int>::type = 0>
+		inline UltaType& operator=(const E& expression)
+		{
+			expression.Assign(*this);
+			return *this;
+		}
+
+		template <typename T, typename std::enable_if<!ULTExpression::__ULTIsExpression_t<T>::value &&
+														  !ULTVariant::__ULTIsClosedVariant_t<T>::value,
+													  int>::type = 0>
+		inline UltaType& operator=(const T& value)
+		{
+			SetValue<T>(value);
+			return *this;
+		}
+
+		// Mutable accessors below give this value its own copy of shared payload first,
+		// read through UltaTypeView to avoid that (e.g. from several threads)
+		template <typename T>
+		inline T* GetPointer() const __ULTATYPE_ACCESS_NOEXCEPT
+		{
+			const_cast<UltaType*>(this)->MakeUnique();
+			return reinterpret_cast<T*>(GetData());
+		}
+
+		template <typename T>
+		inline T& GetValueHard() const __ULTATYPE_ACCESS_NOEXCEPT
+		{
+			const_cast<UltaType*>(this)->MakeUnique();
+			T& ref = *reinterpret_cast<T*>(GetData());
+			return ref;
+		}
+
+		template <typename T>
+		T& GetValue() const
+		{
+			if (IsSameType<T>()) return GetValueHard<T>();
+			return const_cast<T&>(ReadValue<T>());
+		}
+
+		// True if other UltaTypes hold the same payload block, see ULTReflection::SharesPayload_t
+		inline bool IsShared() const noexcept
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			return m_pPtr && m_pOps->bShared &&
+				   ULTMemory::__ultSharedHeader(m_pPtr)->aRefs.load(std::memory_order_acquire) != 1;
+#else
+			return false;
+#endif
+		}
+
+		// Converts stored value directly into out. Returns false and leaves out untouched
+		// if stored type can't be converted to T.
+		template <typename T>
+		bool TryGetAs(T& out) const
+		{
+			using namespace ULTConvert;
+			if (IsSameType<T>())
+			{
+				out = *reinterpret_cast<const T*>(GetData());
+				return true;
+			}
+
+			const int toIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+			const Converter_t conv = FindConverter(m_iTypeIndex, m_ziTypeHash, toIndex, typeid(T).hash_code());
+			if (!conv) return false;
+
+			return __ultTryConvert(conv, m_iTypeIndex, GetData(), out);
+		}
+
+#if __cplusplus >= 201703L
+		template <typename T>
+		inline std::optional<T> As() const
+		{
+			std::optional<T> res(std::in_place);
+			if (!TryGetAs<T>(*res)) res.reset();
+			return res;
+		}
+#endif
+
+		// Not for UltaTypeView and closed variants, they are made of UltaType by their own constructors
+		template <typename T, typename = typename std::enable_if<
+								  !std::conditional<std::is_same<typename std::remove_cv<T>::type, UltaTypeView>::value,
+													std::true_type,
+													ULTVariant::__ULTIsClosedVariant_t<T>>::type::value>::type>
+		inline operator T&() const
+		{
+			return GetValue<T>();
+		}
+
+		bool operator==(const UltaType& other) const
+		{
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (comp)
+				return !comp(GetData(), other.GetData()); // ! 'cause 0 - equal
+			return false;
+		}
+
+		template <typename T>
+		inline bool operator==(const T& other) const
+		{
+			return ReadValue<T>() == other;
+		}
+
+		bool operator<(const UltaType& other) const
+		{
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (comp) return comp(GetData(), other.GetData()) == -1;
+			return false;
+		}
+
+		template <typename T>
+		inline bool operator<(const T& other) const
+		{
+			return ReadValue<T>() < other;
+		}
+
+		bool operator<=(const UltaType& other) const
+		{
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (comp)
+			{
+				const auto res = comp(GetData(), other.GetData());
+				return res == -1 || res == 0;
+			}
+			return false;
+		}
+
+		template <typename T>
+		inline bool operator<=(const T& other) const
+		{
+			return ReadValue<T>() <= other;
+		}
+
+		bool operator>(const UltaType& other) const
+		{
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (comp) return comp(GetData(), other.GetData()) == 1;
+			return false;
+		}
+
+		template <typename T>
+		inline bool operator>(const T& other) const
+		{
+			return ReadValue<T>() > other;
+		}
+
+		bool operator>=(const UltaType& other) const
+		{
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (comp)
+			{
+				const auto res = comp(GetData(), other.GetData());
+				return res == 1 || res == 0;
+			}
+			return false;
+		}
+
+		template <typename T>
+		inline bool operator>=(const T& other) const
+		{
+			return ReadValue<T>() >= other;
+		}
+
+		inline bool operator==(const UltaTypeView& other) const;
+		inline bool operator<(const UltaTypeView& other) const;
+		inline bool operator<=(const UltaTypeView& other) const;
+		inline bool operator>(const UltaTypeView& other) const;
+		inline bool operator>=(const UltaTypeView& other) const;
+
+		UltaType operator+(const UltaType& other) const throw()
+		{
+			using namespace ULTOperations;
+			UltaType res = *this;
+			{
+				const OperatorFns_t* fns =
+					FindOperators(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+				if (!fns) return res;
+				res.MakeUnique();
+				fns->Plus(res.GetData(), other.GetData(), res.GetData());
+			}
+			return res;
+		}
+
+		// In place, value keeps its storage
+		UltaType& operator+=(const UltaType& other) throw()
+		{
+			return ApplyInPlace(ULTOperations::Operation_t::OPERATION_PLUS, other);
+		}
+
+		UltaType operator-(const UltaType& other) const throw()
+		{
+			using namespace ULTOperations;
+			UltaType res = *this;
+			{
+				const OperatorFns_t* fns =
+					FindOperators(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+				if (!fns) return res;
+				res.MakeUnique();
+				fns->Minus(res.GetData(), other.GetData(), res.GetData());
+			}
+			return res;
+		}
+
+		// In place, value keeps its storage
+		UltaType& operator-=(const UltaType& other) throw()
+		{
+			return ApplyInPlace(ULTOperations::Operation_t::OPERATION_MINUS, other);
+		}
+
+		UltaType operator*(const UltaType& other) const throw()
+		{
+			using namespace ULTOperations;
+			UltaType res = *this;
+			{
+				const OperatorFns_t* fns =
+					FindOperators(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+				if (!fns) return res;
+				res.MakeUnique();
+				fns->Multiply(res.GetData(), other.GetData(), res.GetData());
+			}
+			return res;
+		}
+
+		// In place, value keeps its storage
+		UltaType& operator*=(const UltaType& other) throw()
+		{
+			return ApplyInPlace(ULTOperations::Operation_t::OPERATION_MULTIPLY, other);
+		}
+
+		UltaType operator/(const UltaType& other) const throw()
+		{
+			using namespace ULTOperations;
+			UltaType res = *this;
+			{
+				const OperatorFns_t* fns =
+					FindOperators(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+				if (!fns) return res;
+				res.MakeUnique();
+				fns->Divide(res.GetData(), other.GetData(), res.GetData());
+			}
+			return res;
+		}
+
+		// In place, value keeps its storage
+		UltaType& operator/=(const UltaType& other) throw()
+		{
+			return ApplyInPlace(ULTOperations::Operation_t::OPERATION_DIVIDE, other);
+		}
+
+		inline const size_t GetSize() const noexcept { return m_pOps ? m_pOps->ziSize : 0; }
+
+		inline const size_t GetTypeHash() const noexcept { return m_ziTypeHash; }
+
+		// Agrees with operator==, equal values of different numeric types have equal hashes
+		inline size_t GetHash() const noexcept;
+
+		// nullptr if payloads come from global operator new
+		inline ULTMemory::MemoryResource_t* GetResource() const noexcept { return m_pResource; }
+
+		inline ULTReflection::BaseTypes_t GetTypeIndex() const noexcept
+		{
+			return (ULTReflection::BaseTypes_t)m_iTypeIndex;
+		}
+
+		template <typename T>
+		inline bool IsSameType() const noexcept
+		{
+			return ULTReflection::TypeIndex_t<T>::value != ULTReflection::BaseTypes_t::TYPE_UNKNOWN
+					   ? m_iTypeIndex == (int)ULTReflection::TypeIndex_t<T>::value
+					   : m_ziTypeHash == typeid(T).hash_code();
+		}
+
+#ifdef ULTATYPE_SAVE_TYPENAME
+		// Name is looked up through type, values don't hold or copy it. Empty string for empty UltaType.
+		inline UltaTypeName_t GetTypeName() const
+		{
+			static const std::string g_strEmpty;
+			return m_pOps ? ULTReflection::GetTypeName(*m_pOps) : g_strEmpty;
+		}
+#endif
+
+	private:
+		// Same as GetValue without taking payload out of sharing, for comparisons
+		template <typename T>
+		const T& ReadValue() const
+		{
+			using namespace ULTConvert;
+			static thread_local T g_THLocalTmp;
+
+			if (IsSameType<T>()) return *reinterpret_cast<const T*>(GetData());
+
+			const int toIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+			const Converter_t conv = FindConverter(m_iTypeIndex, m_ziTypeHash, toIndex, typeid(T).hash_code());
+			if (conv)
+			{
+				T& ref = g_THLocalTmp;
+				conv(GetData(), (void*)&ref);
+				return ref;
+			}
+
+			return *reinterpret_cast<const T*>(GetData());
+		}
+
+		inline void* AllocatePayload(size_t size, size_t align)
+		{
+			void* block = ULTMemory::Allocate(m_pResource, size, align);
+			__ULTATYPE_STAT(ULTStats::CountAllocation(size));
+			return block;
+		}
+
+		inline void DeallocatePayload(void* block, size_t size, size_t align) noexcept
+		{
+			ULTMemory::Deallocate(m_pResource, block, size, align);
+			__ULTATYPE_STAT(ULTStats::CountDeallocation());
+		}
+
+		// Payload block for type, shared types get reference count (of 1) in front of payload
+		inline UltaTypeByte_t* AllocateBlock(const ULTReflection::TypeOps_t* ops)
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			if (ops->bShared)
+			{
+				const size_t offset = ULTMemory::__ultSharedOffset(ops->ziAlign);
+				UltaTypeByte_t* block = (UltaTypeByte_t*)AllocatePayload(offset + ops->ziSize,
+																		 ULTMemory::__ultSharedAlign(ops->ziAlign));
+				new (block + offset - sizeof(ULTMemory::__ULTSharedHeader_t)) ULTMemory::__ULTSharedHeader_t{{1}};
+				return block + offset;
+			}
+#endif
+			return (UltaTypeByte_t*)AllocatePayload(ops->ziSize, ops->ziAlign);
+		}
+
+		inline void DeallocateBlock(UltaTypeByte_t* payload, const ULTReflection::TypeOps_t* ops) noexcept
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			if (ops->bShared)
+			{
+				const size_t offset = ULTMemory::__ultSharedOffset(ops->ziAlign);
+				DeallocatePayload(payload - offset, offset + ops->ziSize, ULTMemory::__ultSharedAlign(ops->ziAlign));
+				return;
+			}
+#endif
+			DeallocatePayload(payload, ops->ziSize, ops->ziAlign);
+		}
+
+		// Block of this value can be referenced by value using resource instead of being copied
+		inline bool CanShare(const ULTMemory::MemoryResource_t* resource) const noexcept
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			return m_pPtr && m_pOps->bShared && m_pResource == resource;
+#else
+			(void)resource;
+			return false;
+#endif
+		}
+
+		static inline void AddRef(UltaTypeByte_t* payload) noexcept
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			ULTMemory::__ultSharedHeader(payload)->aRefs.fetch_add(1, std::memory_order_relaxed);
+#else
+			(void)payload;
+#endif
+		}
+
+		// Drops this owner of payload, returns true if payload must be destroyed
+		inline bool Release() noexcept
+		{
+#ifdef ULTATYPE_SHARED_PAYLOADS
+			if (m_pPtr && m_pOps->bShared)
+				return ULTMemory::__ultSharedHeader(m_pPtr)->aRefs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+#endif
+			return true;
+		}
+
+		// Gives this value private copy of shared payload before it's changed
+		inline void MakeUnique()
+		{
+			if (!IsShared()) return;
+
+			UltaTypeByte_t* block = AllocateBlock(m_pOps);
+			try
+			{
+				CopyPayload(m_pOps, m_pPtr, block);
+			}
+			catch (...)
+			{
+				DeallocateBlock(block, m_pOps);
+				throw;
+			}
+			if (Release()) // Other owners were gone meanwhile
+			{
+				if (!m_pOps->bTrivial) m_pOps->Destroy(m_pPtr);
+				DeallocateBlock(m_pPtr, m_pOps);
+			}
+			m_pPtr = block;
+		}
+
+		static inline void CopyPayload(const ULTReflection::TypeOps_t* ops, const void* src, void* dst)
+		{
+			if (ops->bTrivial)
+				memcpy(dst, src, ops->ziSize);
+			else
+				ops->CopyConstruct(src, dst);
+		}
+
+		template <typename T>
+		inline void Emplace(const T& value, std::true_type /*inline*/)
+		{
+			Reset();
+			new (m_aInlineBuf) T(value);
+		}
+
+		template <typename T>
+		inline void Emplace(const T& value, std::false_type /*heap*/)
+		{
+			UltaTypeByte_t* block = AllocateBlock(ULTReflection::GetTypeOps<T>());
+			try
+			{
+				new (block) T(value);
+			}
+			catch (...)
+			{
+				DeallocateBlock(block, ULTReflection::GetTypeOps<T>());
+				throw;
+			}
+			Reset();
+			m_pPtr = block;
+		}
+
+		inline UltaType& ApplyInPlace(ULTOperations::Operation_t op, const UltaType& other)
+		{
+			using namespace ULTOperations;
+			const OperatorFns_t* fns =
+				FindOperators(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (!fns) return *this;
+			MakeUnique();
+			SelectOperator(*fns, op)(GetData(), other.GetData(), GetData());
+			return *this;
+		}
+
+		// Copy constructs payload of empty UltaType, allocating block if needed
+		inline void ConstructFrom(const ULTReflection::TypeOps_t* ops, const void* src)
+		{
+			UltaTypeByte_t* data = m_aInlineBuf;
+			if (!ops->bInline) data = AllocateBlock(ops);
+
+			try
+			{
+				CopyPayload(ops, src, data);
+			}
+			catch (...)
+			{
+				if (data != m_aInlineBuf) DeallocateBlock(data, ops);
+				throw;
+			}
+			if (data != m_aInlineBuf) m_pPtr = data;
+		}
+
+		// Payload lives in m_pPtr when it was allocated from resource, otherwise in m_aInlineBuf
+		inline UltaTypeByte_t* GetData() const noexcept
+		{
+			return m_pPtr ? m_pPtr : const_cast<UltaTypeByte_t*>(m_aInlineBuf);
+		}
+
+	private:
+		size_t m_ziTypeHash;
+		ULTMemory::MemoryResource_t* m_pResource;
+		const ULTReflection::TypeOps_t* m_pOps;
+		int m_iTypeIndex; // ULTReflection::BaseTypes_t
+		UltaTypeByte_t* m_pPtr;
+		alignas(std::max_align_t) UltaTypeByte_t m_aInlineBuf[ULTATYPE_INLINE_SIZE];
+	};
+
+	// Read-only reference to a value stored elsewhere (UltaType, UltaColumn element...).
+	// Doesn't own anything, so it must not outlive the storage it points to.
+	class UltaTypeView final
+	{
+	public:
+		inline UltaTypeView() noexcept
+			: m_ziTypeHash(0), m_ziTypeSize(0), m_pOps(nullptr), m_iTypeIndex(-1), m_pData(nullptr)
+		{
+		}
+		inline UltaTypeView(const UltaType& value) noexcept
+			: m_ziTypeHash(value.m_ziTypeHash), m_ziTypeSize(value.GetSize()), m_pOps(value.m_pOps),
+			  m_iTypeIndex(value.m_iTypeIndex), m_pData(value.m_pOps ? value.GetData() : nullptr)
+		{
+		}
+		inline UltaTypeView(const ULTReflection::TypeOps_t* ops, int typeIndex, const void* data) noexcept
+			: m_ziTypeHash(ops ? ops->pTypeInfo->hash_code() : 0), m_ziTypeSize(ops ? ops->ziSize : 0), m_pOps(ops),
+			  m_iTypeIndex(typeIndex), m_pData(data)
+		{
+		}
+
+		template <typename T>
+		static inline UltaTypeView Of(const T& value) noexcept
+		{
+			return UltaTypeView(ULTReflection::GetTypeOps<T>(), (int)ULTReflection::TypeIndex_t<T>::value, &value);
+		}
+
+		inline const size_t GetSize() const noexcept { return m_ziTypeSize; }
+
+		inline const size_t GetTypeHash() const noexcept { return m_ziTypeHash; }
+
+		// Agrees with operator==, equal values of different numeric types have equal hashes
+		inline size_t GetHash() const noexcept;
+
+		inline ULTReflection::BaseTypes_t GetTypeIndex() const noexcept
+		{
+			return (ULTReflection::BaseTypes_t)m_iTypeIndex;
+		}
+
+		inline const ULTReflection::TypeOps_t* GetTypeOps() const noexcept { return m_pOps; }
+
+		inline const void* GetData() const noexcept { return m_pData; }
+
+		template <typename T>
+		inline bool IsSameType() const noexcept
+		{
+			return ULTReflection::TypeIndex_t<T>::value != ULTReflection::BaseTypes_t::TYPE_UNKNOWN
+					   ? m_iTypeIndex == (int)ULTReflection::TypeIndex_t<T>::value
+					   : m_ziTypeHash == typeid(T).hash_code();
+		}
+
+		template <typename T>
+		inline const T* GetPointer() const noexcept
+		{
+			return reinterpret_cast<const T*>(m_pData);
+		}
+
+		template <typename T>
+		inline const T& GetValueHard() const noexcept
+		{
+			return *reinterpret_cast<const T*>(m_pData);
+		}
+
+		// Same as UltaType::GetValue, but returns converted value by copy
+		template <typename T>
+		T GetValue() const
+		{
+			using namespace ULTConvert;
+			if (IsSameType<T>()) return GetValueHard<T>();
+
+			const int toIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+			const Converter_t conv = FindConverter(m_iTypeIndex, m_ziTypeHash, toIndex, typeid(T).hash_code());
+			if (!conv) return GetValueHard<T>();
+
+			T res = T();
+			conv(m_pData, (void*)&res);
+			return res;
+		}
+
+		template <typename T>
+		bool TryGetAs(T& out) const
+		{
+			using namespace ULTConvert;
+			if (IsSameType<T>())
 			{
-				const auto res = comp->second(m_pPtr.get(), other.m_pPtr.get());
-				return res == 1 || res == 0;
+				out = GetValueHard<T>();
+				return true;
 			}
-			return false;
+
+			const int toIndex = (int)ULTReflection::TypeIndex_t<T>::value;
+			const Converter_t conv = FindConverter(m_iTypeIndex, m_ziTypeHash, toIndex, typeid(T).hash_code());
+			if (!conv) return false;
+
+			return __ultTryConvert(conv, m_iTypeIndex, m_pData, out);
+		}
+
+#if __cplusplus >= 201703L
+		template <typename T>
+		inline std::optional<T> As() const
+		{
+			std::optional<T> res(std::in_place);
+			if (!TryGetAs<T>(*res)) res.reset();
+			return res;
+		}
+#endif
+
+		inline bool operator==(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 0;
+		}
+
+		inline bool operator<(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == -1;
+		}
+
+		inline bool operator<=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == -1 || res == 0);
+		}
+
+		inline bool operator>(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && res == 1;
+		}
+
+		inline bool operator>=(const UltaTypeView& other) const
+		{
+			char res;
+			return Compare(other, res) && (res == 1 || res == 0);
+		}
+
+		inline bool operator==(const UltaType& other) const { return *this == UltaTypeView(other); }
+		inline bool operator<(const UltaType& other) const { return *this < UltaTypeView(other); }
+		inline bool operator<=(const UltaType& other) const { return *this <= UltaTypeView(other); }
+		inline bool operator>(const UltaType& other) const { return *this > UltaTypeView(other); }
+		inline bool operator>=(const UltaType& other) const { return *this >= UltaTypeView(other); }
+
+		template <typename T>
+		inline bool operator==(const T& other) const
+		{
+			return GetValue<T>() == other;
+		}
+
+		template <typename T>
+		inline bool operator<(const T& other) const
+		{
+			return GetValue<T>() < other;
+		}
+
+		template <typename T>
+		inline bool operator<=(const T& other) const
+		{
+			return GetValue<T>() <= other;
+		}
+
+		template <typename T>
+		inline bool operator>(const T& other) const
+		{
+			return GetValue<T>() > other;
 		}
 
 		template <typename T>
@@ -550,96 +2549,577 @@ namespace ULT
 			return GetValue<T>() >= other;
 		}
 
-		UltaType operator+(const UltaType& other) const throw()
+	private:
+		inline bool Compare(const UltaTypeView& other, char& res) const
 		{
-			using namespace ULTOperations;
-			UltaType res = *this;
+			using namespace ULTCompare;
+			const Comparer_t comp = FindComparer(m_iTypeIndex, m_ziTypeHash, other.m_iTypeIndex, other.m_ziTypeHash);
+			if (!comp) return false;
+			res = comp(m_pData, other.m_pData);
+			return true;
+		}
+
+	private:
+		size_t m_ziTypeHash;
+		size_t m_ziTypeSize;
+		const ULTReflection::TypeOps_t* m_pOps;
+		int m_iTypeIndex; // ULTReflection::BaseTypes_t
+		const void* m_pData;
+	};
+
+	inline UltaType::UltaType(const UltaTypeView& view)
+		: m_ziTypeHash(0), m_pResource(nullptr), m_pOps(nullptr), m_iTypeIndex(-1), m_pPtr(nullptr)
+	{
+		*this = view;
+	}
+
+	inline UltaType& UltaType::operator=(const UltaTypeView& view)
+	{
+		const ULTReflection::TypeOps_t* ops = view.GetTypeOps();
+		if (view.GetData() == GetData()) return *this;
+
+		if (m_pOps && m_pOps == ops && !IsShared())
+		{
+			if (m_pOps->bTrivial)
+				memcpy(GetData(), view.GetData(), m_pOps->ziSize);
+			else
+				m_pOps->CopyAssign(view.GetData(), GetData());
+			return *this;
+		}
+
+		Reset();
+		if (!ops) return *this;
+
+		ConstructFrom(ops, view.GetData());
+		m_ziTypeHash = view.GetTypeHash();
+		m_pOps = ops;
+		m_iTypeIndex = (int)view.GetTypeIndex();
+		return *this;
+	}
+
+	namespace ULTExpression
+	{
+		// Operand read from UltaType when expression is evaluated, so expression can be kept and evaluated again
+		struct RefLeaf_t : Expression_t
+		{
+			static constexpr bool bLeaf = true;
+
+			inline explicit RefLeaf_t(const UltaType& value) noexcept : pValue(&value) {}
+
+			inline UltaTypeView View() const noexcept { return UltaTypeView(*pValue); }
+			inline bool References(const UltaType* value) const noexcept { return pValue == value; }
+			inline bool ReferencesAfterFirst(const UltaType*) const noexcept { return false; }
+			inline void EvaluateTo(UltaType& dst) const { dst = View(); }
+			inline void Assign(UltaType& dst) const { EvaluateTo(dst); }
+
+			const UltaType* pValue;
+		};
+
+		struct ViewLeaf_t : Expression_t
+		{
+			static constexpr bool bLeaf = true;
+
+			inline explicit ViewLeaf_t(const UltaTypeView& value) noexcept : view(value) {}
+
+			inline UltaTypeView View() const noexcept { return view; }
+			inline bool References(const UltaType* value) const noexcept
 			{
-				const auto& it = g_Operators.find({m_ziTypeHash, other.m_ziTypeHash});
-				if (it == g_Operators.end()) return res;
-				it->second->Plus(res.m_pPtr.get(), other.m_pPtr.get(), res.m_pPtr.get());
+				return view.GetData() && view.GetData() == UltaTypeView(*value).GetData();
 			}
-			return res;
+			inline bool ReferencesAfterFirst(const UltaType*) const noexcept { return false; }
+			inline void EvaluateTo(UltaType& dst) const { dst = View(); }
+			inline void Assign(UltaType& dst) const { EvaluateTo(dst); }
+
+			UltaTypeView view;
+		};
+
+		// Number stored right in expression
+		template <typename T>
+		struct ScalarLeaf_t : Expression_t
+		{
+			static constexpr bool bLeaf = true;
+
+			inline explicit ScalarLeaf_t(const T& v) noexcept : value(v) {}
+
+			inline UltaTypeView View() const noexcept { return UltaTypeView::Of(value); }
+			inline bool References(const UltaType*) const noexcept { return false; }
+			inline bool ReferencesAfterFirst(const UltaType*) const noexcept { return false; }
+			inline void EvaluateTo(UltaType& dst) const { dst = View(); }
+			inline void Assign(UltaType& dst) const { EvaluateTo(dst); }
+
+			T value;
+		};
+
+		// lhs op rhs. Left operand is evaluated right into destination, right one is applied to it in place,
+		// so only right operands that are expressions themselves need a temporary. Operator of type pair is
+		// looked up once and reused while operand types stay the same.
+		template <typename L, typename R>
+		struct Node_t : Expression_t
+		{
+			static constexpr bool bLeaf = false;
+
+			inline Node_t(const L& l, const R& r, ULTOperations::Operation_t operation) noexcept
+				: lhs(l), rhs(r), op(operation)
+			{
+			}
+
+			inline bool References(const UltaType* value) const noexcept
+			{
+				return lhs.References(value) || rhs.References(value);
+			}
+
+			// Whether value is read after the first (leftmost) operand was written to destination
+			inline bool ReferencesAfterFirst(const UltaType* value) const noexcept
+			{
+				return lhs.ReferencesAfterFirst(value) || rhs.References(value);
+			}
+
+			// dst must not be referenced after the first operand
+			inline void EvaluateTo(UltaType& dst) const
+			{
+				lhs.EvaluateTo(dst);
+				ApplyRight(dst, std::integral_constant<bool, R::bLeaf>());
+			}
+
+			inline void Assign(UltaType& dst) const
+			{
+				if (!ReferencesAfterFirst(&dst))
+				{
+					EvaluateTo(dst);
+					return;
+				}
+
+				UltaType res;
+				EvaluateTo(res);
+				dst = std::move(res);
+			}
+
+			L lhs;
+			R rhs;
+			ULTOperations::Operation_t op;
+			mutable ULTOperations::OperatorCache_t cache;
+
+		private:
+			inline void ApplyRight(UltaType& dst, std::true_type /*leaf*/) const { Apply(dst, rhs.View()); }
+
+			inline void ApplyRight(UltaType& dst, std::false_type /*leaf*/) const
+			{
+				UltaType value;
+				rhs.EvaluateTo(value);
+				Apply(dst, UltaTypeView(value));
+			}
+
+			// Same as UltaType operators, dst is left as is if there is no operator for this pair
+			inline void Apply(UltaType& dst, const UltaTypeView& value) const
+			{
+				const ULTOperations::Operator_t fn = cache.Get(op, (int)dst.GetTypeIndex(), dst.GetTypeHash(),
+															   (int)value.GetTypeIndex(), value.GetTypeHash());
+				if (fn) fn(dst.GetPointer<void>(), value.GetData(), dst.GetPointer<void>());
+			}
+		};
+
+		template <typename T, typename = void>
+		struct __ULTOperand_t
+		{
+		};
+
+		template <typename T>
+		struct __ULTOperand_t<T, typename std::enable_if<__ULTIsExpression_t<T>::value>::type>
+		{
+			using type = T;
+			static inline const T& Make(const T& value) noexcept { return value; }
+		};
+
+		template <>
+		struct __ULTOperand_t<UltaType>
+		{
+			using type = RefLeaf_t;
+			static inline RefLeaf_t Make(const UltaType& value) noexcept { return RefLeaf_t(value); }
+		};
+
+		template <>
+		struct __ULTOperand_t<UltaTypeView>
+		{
+			using type = ViewLeaf_t;
+			static inline ViewLeaf_t Make(const UltaTypeView& value) noexcept { return ViewLeaf_t(value); }
+		};
+
+		template <typename T>
+		struct __ULTOperand_t<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+		{
+			using type = ScalarLeaf_t<T>;
+			static inline ScalarLeaf_t<T> Make(const T& value) noexcept { return ScalarLeaf_t<T>(value); }
+		};
+
+		// Node of L op R, where at least one side is already an expression
+		template <typename L, typename R>
+		using __ULTLazyNode_t = typename std::enable_if<
+			__ULTIsExpression_t<L>::value || __ULTIsExpression_t<R>::value,
+			Node_t<typename __ULTOperand_t<L>::type, typename __ULTOperand_t<R>::type>>::type;
+
+		template <typename L, typename R>
+		inline __ULTLazyNode_t<L, R> MakeNode(const L& l, const R& r, ULTOperations::Operation_t op)
+		{
+			return __ULTLazyNode_t<L, R>(__ULTOperand_t<L>::Make(l), __ULTOperand_t<R>::Make(r), op);
 		}
+	} // namespace ULTExpression
+
+	// Starts lazily evaluated expression: UltaType r = ULT::Lazy(a) + ULT::Lazy(b) * c - 2;
+	// Operators of expression build a tree instead of computing, it's evaluated in one pass when assigned
+	// to UltaType. Plain UltaType operators are still eager, so every operand that isn't the left side of
+	// an expression operator must be wrapped (b above). Operands are referenced, not copied.
+	inline ULTExpression::RefLeaf_t Lazy(const UltaType& value) noexcept { return ULTExpression::RefLeaf_t(value); }
+	inline ULTExpression::ViewLeaf_t Lazy(const UltaTypeView& value) noexcept
+	{
+		return ULTExpression::ViewLeaf_t(value);
+	}
+
+	template <typename L, typename R>
+	inline ULTExpression::__ULTLazyNode_t<L, R> operator+(const L& l, const R& r)
+	{
+		return ULTExpression::MakeNode(l, r, ULTOperations::Operation_t::OPERATION_PLUS);
+	}
+
+	template <typename L, typename R>
+	inline ULTExpression::__ULTLazyNode_t<L, R> operator-(const L& l, const R& r)
+	{
+		return ULTExpression::MakeNode(l, r, ULTOperations::Operation_t::OPERATION_MINUS);
+	}
 
-		UltaType operator+=(const UltaType& other) throw()
+	template <typename L, typename R>
+	inline ULTExpression::__ULTLazyNode_t<L, R> operator*(const L& l, const R& r)
+	{
+		return ULTExpression::MakeNode(l, r, ULTOperations::Operation_t::OPERATION_MULTIPLY);
+	}
+
+	template <typename L, typename R>
+	inline ULTExpression::__ULTLazyNode_t<L, R> operator/(const L& l, const R& r)
+	{
+		return ULTExpression::MakeNode(l, r, ULTOperations::Operation_t::OPERATION_DIVIDE);
+	}
+
+	namespace ULTOperations
+	{
+		// result[i] = a[i] op b[i], pairs without operator give copy of a[i] like UltaType operators do.
+		// Dispatch is resolved once per run of equal type pairs.
+		inline void ApplyN(Operation_t op, const UltaType* a, const UltaType* b, UltaType* result, size_t n)
 		{
-			*this = *this + other;
-			return *this;
+			OperatorCache_t cache;
+			for (size_t i = 0; i < n; i++)
+			{
+				const Operator_t fn = cache.Get(op, (int)a[i].GetTypeIndex(), a[i].GetTypeHash(),
+												(int)b[i].GetTypeIndex(), b[i].GetTypeHash());
+
+				if (&result[i] == &b[i] && &result[i] != &a[i])
+				{
+					const UltaType rhs = b[i];
+					result[i] = a[i];
+					if (fn) fn(result[i].GetPointer<void>(), UltaTypeView(rhs).GetData(), result[i].GetPointer<void>());
+					continue;
+				}
+
+				if (&result[i] != &a[i]) result[i] = a[i];
+				if (fn) fn(result[i].GetPointer<void>(), UltaTypeView(b[i]).GetData(), result[i].GetPointer<void>());
+			}
 		}
+	} // namespace ULTOperations
 
-		UltaType operator-(const UltaType& other) const throw()
+	inline void PlusN(const UltaType* a, const UltaType* b, UltaType* result, size_t n)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_PLUS, a, b, result, n);
+	}
+
+	inline void MinusN(const UltaType* a, const UltaType* b, UltaType* result, size_t n)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_MINUS, a, b, result, n);
+	}
+
+	inline void MultiplyN(const UltaType* a, const UltaType* b, UltaType* result, size_t n)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_MULTIPLY, a, b, result, n);
+	}
+
+	inline void DivideN(const UltaType* a, const UltaType* b, UltaType* result, size_t n)
+	{
+		ULTOperations::ApplyN(ULTOperations::Operation_t::OPERATION_DIVIDE, a, b, result, n);
+	}
+
+	namespace ULTReflection
+	{
+		// Value of any numeric BaseTypes_t, wide enough to compare values of different types exactly
+		struct Number_t
 		{
-			using namespace ULTOperations;
-			UltaType res = *this;
+			enum class Kind_t : int
+			{
+				NUMBER_SIGNED,
+				NUMBER_UNSIGNED,
+				NUMBER_FLOATING,
+			};
+
+			Kind_t eKind;
+			long long iSigned;
+			unsigned long long uiUnsigned;
+			long double fFloating;
+
+			inline long double ToLongDouble() const noexcept
 			{
-				const auto& it = g_Operators.find({m_ziTypeHash, other.m_ziTypeHash});
-				if (it == g_Operators.end()) return res;
-				it->second->Minus(res.m_pPtr.get(), other.m_pPtr.get(), res.m_pPtr.get());
+				return eKind == Kind_t::NUMBER_SIGNED
+						   ? (long double)iSigned
+						   : (eKind == Kind_t::NUMBER_UNSIGNED ? (long double)uiUnsigned : fFloating);
+			}
+		};
+
+		template <typename T>
+		inline void __ultSetNumber(T value, Number_t& out) noexcept
+		{
+			out.iSigned = 0;
+			out.uiUnsigned = 0;
+			out.fFloating = 0;
+			if (std::is_floating_point<T>::value)
+			{
+				out.eKind = Number_t::Kind_t::NUMBER_FLOATING;
+				out.fFloating = (long double)value;
+			}
+			else if (std::is_signed<T>::value)
+			{
+				out.eKind = Number_t::Kind_t::NUMBER_SIGNED;
+				out.iSigned = (long long)value;
+			}
+			else
+			{
+				out.eKind = Number_t::Kind_t::NUMBER_UNSIGNED;
+				out.uiUnsigned = (unsigned long long)value;
 			}
-			return res;
 		}
 
-		UltaType operator-=(const UltaType& other) throw()
+		// Returns false if typeIndex isn't numeric BaseTypes_t
+		inline bool ReadNumber(int typeIndex, const void* data, Number_t& out) noexcept
 		{
-			*this = *this - other;
-			return *this;
+			switch ((BaseTypes_t)typeIndex)
+			{
+			case BaseTypes_t::TYPE_CHAR:
+				__ultSetNumber(*(const char*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_SHORT:
+				__ultSetNumber(*(const short*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_INT:
+				__ultSetNumber(*(const int*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_LONG:
+				__ultSetNumber(*(const long*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_LONGLONG:
+				__ultSetNumber(*(const long long*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_UCHAR:
+				__ultSetNumber(*(const unsigned char*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_USHORT:
+				__ultSetNumber(*(const unsigned short*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_UINT:
+				__ultSetNumber(*(const unsigned int*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_ULONG:
+				__ultSetNumber(*(const unsigned long*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_ULONGLONG:
+				__ultSetNumber(*(const unsigned long long*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_FLOAT:
+				__ultSetNumber(*(const float*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_DOUBLE:
+				__ultSetNumber(*(const double*)data, out);
+				return true;
+			case BaseTypes_t::TYPE_LONGDOUBLE:
+				__ultSetNumber(*(const long double*)data, out);
+				return true;
+			default:
+				return false;
+			}
 		}
 
-		UltaType operator*(const UltaType& other) const throw()
+		inline size_t HashMix(unsigned long long x) noexcept
 		{
-			using namespace ULTOperations;
-			UltaType res = *this;
+			x ^= x >> 33;
+			x *= 0xFF51AFD7ED558CCDull;
+			x ^= x >> 33;
+			x *= 0xC4CEB9FE1A85EC53ull;
+			x ^= x >> 33;
+			return (size_t)x;
+		}
+
+		// Hash of std::string contents, usable for char pointers and std::string_view without making a string
+		inline size_t HashBytes(const void* data, size_t size) noexcept
+		{
+			const unsigned char* p = (const unsigned char*)data;
+			unsigned long long h = 0x9E3779B97F4A7C15ull ^ size;
+			for (; size >= 8; size -= 8, p += 8)
 			{
-				const auto& it = g_Operators.find({m_ziTypeHash, other.m_ziTypeHash});
-				if (it == g_Operators.end()) return res;
-				it->second->Multiply(res.m_pPtr.get(), other.m_pPtr.get(), res.m_pPtr.get());
+				unsigned long long chunk;
+				memcpy(&chunk, p, 8);
+				h = (h ^ chunk) * 0xBF58476D1CE4E5B9ull;
+				h ^= h >> 29;
 			}
-			return res;
+			unsigned long long tail = 0;
+			memcpy(&tail, p, size);
+			return HashMix(h ^ tail);
 		}
 
-		UltaType operator*=(const UltaType& other) throw()
+		// Equal numbers of any types have equal hashes: 5, 5L and 5.0 hash the same way
+		inline size_t HashNumber(const Number_t& number) noexcept
 		{
-			*this = *this * other;
-			return *this;
+			switch (number.eKind)
+			{
+			case Number_t::Kind_t::NUMBER_SIGNED:
+				return HashMix((unsigned long long)number.iSigned);
+			case Number_t::Kind_t::NUMBER_UNSIGNED:
+				return HashMix(number.uiUnsigned);
+			default:
+				break;
+			}
+
+			const long double f = number.fFloating;
+			if (f != f) return HashMix(0x7FF8000000000000ull);
+			if (f >= -9223372036854775808.0L && f < 9223372036854775808.0L)
+			{
+				const long long i = (long long)f;
+				if ((long double)i == f) return HashMix((unsigned long long)i);
+			}
+			else if (f >= 0 && f < 18446744073709551616.0L)
+			{
+				const unsigned long long u = (unsigned long long)f;
+				if ((long double)u == f) return HashMix(u);
+			}
+
+			// Every float is exactly representable as double
+			const double d = (double)f;
+			unsigned long long bits;
+			memcpy(&bits, &d, sizeof(bits));
+			return HashMix(bits ^ 0x5851F42D4C957F2Dull);
 		}
+	} // namespace ULTReflection
 
-		UltaType operator/(const UltaType& other) const throw()
+	namespace ULTCompare
+	{
+		// Compares by mathematical value, without usual arithmetic conversions (-1 < 0u here).
+		// NaN is greater than any other number and equal to NaN.
+		inline int CompareNumbers(const ULTReflection::Number_t& a, const ULTReflection::Number_t& b) noexcept
 		{
-			using namespace ULTOperations;
-			UltaType res = *this;
+			using Kind_t = ULTReflection::Number_t::Kind_t;
+			if (a.eKind == Kind_t::NUMBER_FLOATING || b.eKind == Kind_t::NUMBER_FLOATING)
 			{
-				const auto& it = g_Operators.find({m_ziTypeHash, other.m_ziTypeHash});
-				if (it == g_Operators.end()) return res;
-				it->second->Divide(res.m_pPtr.get(), other.m_pPtr.get(), res.m_pPtr.get());
+				const long double x = a.ToLongDouble();
+				const long double y = b.ToLongDouble();
+				const bool xNaN = x != x;
+				const bool yNaN = y != y;
+				if (xNaN || yNaN) return xNaN == yNaN ? 0 : (xNaN ? 1 : -1);
+				return x < y ? -1 : (y < x ? 1 : 0);
 			}
-			return res;
+
+			if (a.eKind == Kind_t::NUMBER_SIGNED && b.eKind == Kind_t::NUMBER_SIGNED)
+				return a.iSigned < b.iSigned ? -1 : (b.iSigned < a.iSigned ? 1 : 0);
+			if (a.eKind == Kind_t::NUMBER_SIGNED && a.iSigned < 0) return -1;
+			if (b.eKind == Kind_t::NUMBER_SIGNED && b.iSigned < 0) return 1;
+
+			const unsigned long long x =
+				a.eKind == Kind_t::NUMBER_SIGNED ? (unsigned long long)a.iSigned : a.uiUnsigned;
+			const unsigned long long y =
+				b.eKind == Kind_t::NUMBER_SIGNED ? (unsigned long long)b.iSigned : b.uiUnsigned;
+			return x < y ? -1 : (y < x ? 1 : 0);
 		}
 
-		UltaType operator/=(const UltaType& other) throw()
+		// Total order over all values, usable for sorting mixed collections:
+		// empty < numbers < std::string < other types.
+		// Numbers are ordered by value, equal values of different types by BaseTypes_t.
+		// Other types are grouped by type hash and ordered by registered comparer if there is one.
+		inline int TotalCompare(const UltaTypeView& a, const UltaTypeView& b)
 		{
-			*this = *this * other;
-			return *this;
+			using ULTReflection::BaseTypes_t;
+			const auto rank = [](const UltaTypeView& v) -> int {
+				if (!v.GetTypeOps()) return 0;
+				if (v.GetTypeIndex() == BaseTypes_t::TYPE_STDSTRING) return 2;
+				return ULTReflection::IsBaseType((int)v.GetTypeIndex()) ? 1 : 3;
+			};
+
+			const int aRank = rank(a);
+			const int bRank = rank(b);
+			if (aRank != bRank) return aRank < bRank ? -1 : 1;
+
+			switch (aRank)
+			{
+			case 1:
+			{
+				ULTReflection::Number_t x, y;
+				ULTReflection::ReadNumber((int)a.GetTypeIndex(), a.GetData(), x);
+				ULTReflection::ReadNumber((int)b.GetTypeIndex(), b.GetData(), y);
+				const int res = CompareNumbers(x, y);
+				if (res) return res;
+				return a.GetTypeIndex() < b.GetTypeIndex() ? -1 : (b.GetTypeIndex() < a.GetTypeIndex() ? 1 : 0);
+			}
+			case 2:
+			{
+				const int res = a.GetValueHard<std::string>().compare(b.GetValueHard<std::string>());
+				return res < 0 ? -1 : (res > 0 ? 1 : 0);
+			}
+			case 3:
+			{
+				if (a.GetTypeHash() != b.GetTypeHash()) return a.GetTypeHash() < b.GetTypeHash() ? -1 : 1;
+				const Comparer_t comp = FindComparer((int)a.GetTypeIndex(), a.GetTypeHash(), (int)b.GetTypeIndex(),
+													 b.GetTypeHash());
+				return comp ? comp(a.GetData(), b.GetData()) : 0;
+			}
+			default:
+				return 0;
+			}
 		}
+	} // namespace ULTCompare
 
-		inline const size_t GetSize() const noexcept { return m_ziTypeSize; }
+	// Empty values hash to 0, numbers and strings by value (see HashNumber, HashBytes),
+	// other types by type and std::hash<T> if it's available.
+	// Equality registered between different types outside of BaseTypes_t isn't taken into account.
+	inline size_t UltaTypeView::GetHash() const noexcept
+	{
+		using ULTReflection::BaseTypes_t;
+		if (!m_pOps) return 0;
 
-		inline const size_t GetTypeHash() const noexcept { return m_ziTypeHash; }
+		if (m_iTypeIndex == (int)BaseTypes_t::TYPE_STDSTRING)
+		{
+			const std::string& str = *(const std::string*)m_pData;
+			return ULTReflection::HashBytes(str.data(), str.size());
+		}
 
-#ifdef ULTATYPE_SAVE_TYPENAME
+		ULTReflection::Number_t number;
+		if (ULTReflection::ReadNumber(m_iTypeIndex, m_pData, number)) return ULTReflection::HashNumber(number);
 
-	public:
-		UltaTypeName_t GetTypeName() const { return m_strTypeName.c_str(); }
+		const size_t valueHash = m_pOps->Hash ? ULTReflection::HashMix(m_pOps->Hash(m_pData)) : 0;
+		return ULTReflection::HashMix(m_ziTypeHash ^ valueHash);
+	}
 
-	private:
-		std::string m_strTypeName;
-#endif
+	inline size_t UltaType::GetHash() const noexcept { return UltaTypeView(*this).GetHash(); }
 
-	private:
-		size_t m_ziTypeHash;
-		size_t m_ziTypeSize;
-		std::unique_ptr<UltaTypeByte_t[]> m_pPtr;
-	};
+	inline bool UltaType::operator==(const UltaTypeView& other) const { return UltaTypeView(*this) == other; }
+	inline bool UltaType::operator<(const UltaTypeView& other) const { return UltaTypeView(*this) < other; }
+	inline bool UltaType::operator<=(const UltaTypeView& other) const { return UltaTypeView(*this) <= other; }
+	inline bool UltaType::operator>(const UltaTypeView& other) const { return UltaTypeView(*this) > other; }
+	inline bool UltaType::operator>=(const UltaTypeView& other) const { return UltaTypeView(*this) >= other; }
 } // namespace ULT
 
+namespace std
+{
+	template <>
+	struct hash<ULT::UltaType>
+	{
+		inline size_t operator()(const ULT::UltaType& value) const noexcept { return value.GetHash(); }
+	};
+
+	template <>
+	struct hash<ULT::UltaTypeView>
+	{
+		inline size_t operator()(const ULT::UltaTypeView& value) const noexcept { return value.GetHash(); }
+	};
+} // namespace std
+
 #endif
@@ -0,0 +1,534 @@
+/*
+============================================
+- File: ultatypeof.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: UltaTypeOf is UltaType limited
+  to a set of types known at compile time.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTATYPEOF_HPP
+#define ULTATYPEOF_HPP
+
+#include "ultatype.hpp"
+
+#include <tuple>
+
+namespace ULT
+{
+	namespace ULTVariant
+	{
+		// Position of T in Ts, sizeof...(Ts) if it isn't there
+		template <typename T, typename... Ts>
+		struct __ULTIndexOf_t : std::integral_constant<size_t, 0>
+		{
+		};
+
+		template <typename T, typename... Ts>
+		struct __ULTIndexOf_t<T, T, Ts...> : std::integral_constant<size_t, 0>
+		{
+		};
+
+		template <typename T, typename U, typename... Ts>
+		struct __ULTIndexOf_t<T, U, Ts...> : std::integral_constant<size_t, 1 + __ULTIndexOf_t<T, Ts...>::value>
+		{
+		};
+
+		template <size_t... Ns>
+		struct __ULTMax_t : std::integral_constant<size_t, 0>
+		{
+		};
+
+		template <size_t N, size_t... Ns>
+		struct __ULTMax_t<N, Ns...>
+			: std::integral_constant<size_t, (N > __ULTMax_t<Ns...>::value ? N : __ULTMax_t<Ns...>::value)>
+		{
+		};
+
+		template <bool... Bs>
+		struct __ULTAll_t : std::true_type
+		{
+		};
+
+		template <bool B, bool... Bs>
+		struct __ULTAll_t<B, Bs...> : std::integral_constant<bool, B && __ULTAll_t<Bs...>::value>
+		{
+		};
+
+		// Calls fn with value of I-th type. Chain of index checks is inlined, so compiler makes it a jump table.
+		template <size_t I, typename... Ts>
+		struct __ULTVisit_t
+		{
+			template <typename R, typename P, typename F>
+			static inline R Visit(size_t, P*, F&&)
+			{
+				return R(); // Empty, never reached through UltaTypeOf::Visit
+			}
+		};
+
+		template <size_t I, typename T, typename... Ts>
+		struct __ULTVisit_t<I, T, Ts...>
+		{
+			template <typename R, typename P, typename F>
+			static inline R Visit(size_t index, P* data, F&& fn)
+			{
+				using Value_t = typename std::conditional<std::is_const<P>::value, const T, T>::type;
+				if (index == I) return fn(*(Value_t*)data);
+				return __ULTVisit_t<I + 1, Ts...>::template Visit<R>(index, data, std::forward<F>(fn));
+			}
+		};
+
+		template <typename T>
+		using __ULTIsBase_t = std::integral_constant<bool, ULTReflection::TypeIndex_t<T>::value !=
+															   ULTReflection::BaseTypes_t::TYPE_UNKNOWN>;
+
+		template <typename A, typename B>
+		using __ULTIsBasePair_t = std::integral_constant<bool, __ULTIsBase_t<A>::value && __ULTIsBase_t<B>::value>;
+
+		// Same pairs as in dense tables of ultatype.hpp, so results are the same as with UltaType.
+		// 0 - registry is searched at runtime, 1 - no such function, 2 and more - built in.
+		template <typename A, typename B>
+		using __ULTCompareDispatch_t = std::integral_constant<
+			int, !__ULTIsBasePair_t<A, B>::value
+					 ? 0
+					 : ((std::is_arithmetic<A>::value && std::is_arithmetic<B>::value) ||
+								(std::is_same<A, std::string>::value && std::is_same<B, std::string>::value)
+							? 2
+							: 1)>;
+
+		template <typename A, typename B>
+		using __ULTOperatorDispatch_t = std::integral_constant<
+			int, !__ULTIsBasePair_t<A, B>::value
+					 ? 0
+					 : (std::is_arithmetic<A>::value && std::is_arithmetic<B>::value ? 2 : 1)>;
+
+		// 2 - static_cast, 3 - to string, 4 - from string
+		template <typename S, typename T>
+		using __ULTConvertDispatch_t = std::integral_constant<
+			int, !__ULTIsBasePair_t<S, T>::value
+					 ? 0
+					 : (std::is_arithmetic<S>::value && std::is_arithmetic<T>::value
+							? 2
+							: (std::is_arithmetic<S>::value && std::is_same<T, std::string>::value
+								   ? 3
+								   : (std::is_same<S, std::string>::value && std::is_arithmetic<T>::value ? 4 : 1)))>;
+
+		// -1, 0 or 1 like ULTCompare::Comparer_t, 2 if values can't be compared
+		template <typename A, typename B>
+		inline int __ultCompare(const A& a, const B& b, std::integral_constant<int, 2> /*built in*/)
+		{
+			return (signed char)ULTCompare::__ultBaseComparer<A, B>(&a, &b);
+		}
+
+		template <typename A, typename B>
+		inline int __ultCompare(const A&, const B&, std::integral_constant<int, 1> /*none*/)
+		{
+			return 2;
+		}
+
+		template <typename A, typename B>
+		inline int __ultCompare(const A& a, const B& b, std::integral_constant<int, 0> /*registry*/)
+		{
+			const ULTCompare::Comparer_t comp =
+				ULTCompare::FindComparer((int)ULTReflection::TypeIndex_t<A>::value, typeid(A).hash_code(),
+										 (int)ULTReflection::TypeIndex_t<B>::value, typeid(B).hash_code());
+			return comp ? (signed char)comp(&a, &b) : 2;
+		}
+
+		template <ULTOperations::Operation_t Op, typename A, typename B>
+		inline void __ultApply(A& a, const B& b, std::integral_constant<int, 2> /*built in*/)
+		{
+			using Fns_t = ULTOperations::__ULTBaseTOperator_t<A, B>;
+			switch (Op)
+			{
+			case ULTOperations::Operation_t::OPERATION_PLUS:
+				Fns_t::Plus(&a, &b, &a);
+				break;
+			case ULTOperations::Operation_t::OPERATION_MINUS:
+				Fns_t::Minus(&a, &b, &a);
+				break;
+			case ULTOperations::Operation_t::OPERATION_MULTIPLY:
+				Fns_t::Multiply(&a, &b, &a);
+				break;
+			case ULTOperations::Operation_t::OPERATION_DIVIDE:
+				Fns_t::Divide(&a, &b, &a);
+				break;
+			}
+		}
+
+		template <ULTOperations::Operation_t Op, typename A, typename B>
+		inline void __ultApply(A&, const B&, std::integral_constant<int, 1> /*none*/)
+		{
+		}
+
+		template <ULTOperations::Operation_t Op, typename A, typename B>
+		inline void __ultApply(A& a, const B& b, std::integral_constant<int, 0> /*registry*/)
+		{
+			const ULTOperations::OperatorFns_t* fns =
+				ULTOperations::FindOperators((int)ULTReflection::TypeIndex_t<A>::value, typeid(A).hash_code(),
+											 (int)ULTReflection::TypeIndex_t<B>::value, typeid(B).hash_code());
+			if (fns) ULTOperations::SelectOperator(*fns, Op)(&a, &b, &a);
+		}
+
+		template <typename S, typename T>
+		inline bool __ultConvert(const S& src, T& dst, std::integral_constant<int, 2> /*static_cast*/)
+		{
+			ULTConvert::__utBaseConverter<S, T>(&src, &dst);
+			return true;
+		}
+
+		template <typename S, typename T>
+		inline bool __ultConvert(const S& src, T& dst, std::integral_constant<int, 3> /*to string*/)
+		{
+			ULTConvert::__ultToStringConverter<S>(&src, &dst);
+			return true;
+		}
+
+		template <typename S, typename T>
+		inline bool __ultConvert(const S& src, T& dst, std::integral_constant<int, 4> /*from string*/)
+		{
+			return ULTConvert::__ultParse(&src, dst, ULTConvert::__ULTIsNumber_t<T>());
+		}
+
+		template <typename S, typename T>
+		inline bool __ultConvert(const S&, T&, std::integral_constant<int, 1> /*none*/)
+		{
+			return false;
+		}
+
+		template <typename S, typename T>
+		inline bool __ultConvert(const S& src, T& dst, std::integral_constant<int, 0> /*registry*/)
+		{
+			const ULTConvert::Converter_t conv =
+				ULTConvert::FindConverter((int)ULTReflection::TypeIndex_t<S>::value, typeid(S).hash_code(),
+										  (int)ULTReflection::TypeIndex_t<T>::value, typeid(T).hash_code());
+			if (!conv) return false;
+			return ULTConvert::__ultTryConvert(conv, (int)ULTReflection::TypeIndex_t<S>::value, &src, dst);
+		}
+	} // namespace ULTVariant
+
+	// UltaType for call sites that know every type they store. Value lives inline in storage sized for
+	// the largest of Ts and is identified by its position in Ts, so there's no type hash, no allocation and
+	// no lookup: conversions, comparisons and arithmetic are picked at compile time for every pair of Ts
+	// and give the same results as UltaType. Only pairs outside of built in ones search
+	// registries of ULT::RegisterConverter/RegisterComparer/RegisterOperators at runtime.
+	// Converts to UltaType and explicitly back, UltaType holding type outside of Ts gives empty UltaTypeOf.
+	// Values of other types don't convert to UltaTypeOf through UltaType: v = 5L doesn't compile for
+	// UltaTypeOf<int, double>.
+	template <typename... Ts>
+	class UltaTypeOf final : public ULTVariant::ClosedVariant_t
+	{
+		static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) < 255, "UltaTypeOf needs from 1 to 254 types");
+
+	public:
+		static constexpr size_t g_ziEmpty = sizeof...(Ts); // Index of empty UltaTypeOf
+
+		template <typename T>
+		using IndexOf_t = ULTVariant::__ULTIndexOf_t<T, Ts...>;
+
+		template <size_t I>
+		using TypeAt_t = typename std::tuple_element<I, std::tuple<Ts...>>::type;
+
+	private:
+		template <typename T>
+		using __ULTIsStored_t = std::integral_constant<bool, IndexOf_t<T>::value != g_ziEmpty>;
+
+		// Only UltaType itself, not anything implicitly convertible to it
+		template <typename T>
+		using __ULTIsUltaType_t = typename std::enable_if<std::is_same<T, UltaType>::value, int>::type;
+
+		using __ULTNothrowMove_t = ULTVariant::__ULTAll_t<std::is_nothrow_move_constructible<Ts>::value...>;
+		using __ULTNothrowMoveAssign_t = ULTVariant::__ULTAll_t<(std::is_nothrow_move_constructible<Ts>::value &&
+																  std::is_nothrow_move_assignable<Ts>::value)...>;
+
+	public:
+		inline UltaTypeOf() noexcept : m_ucIndex((unsigned char)g_ziEmpty) {}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsStored_t<T>::value>::type>
+		inline UltaTypeOf(const T& value) : m_ucIndex((unsigned char)g_ziEmpty)
+		{
+			Emplace<T>(value);
+		}
+
+		template <typename T, __ULTIsUltaType_t<T> = 0>
+		inline explicit UltaTypeOf(const T& value) : m_ucIndex((unsigned char)g_ziEmpty)
+		{
+			AssignFrom<0>(value);
+		}
+
+		inline UltaTypeOf(const UltaTypeOf& other) : m_ucIndex((unsigned char)g_ziEmpty)
+		{
+			other.Visit([this](const auto& value) { Construct(value); });
+		}
+
+		inline UltaTypeOf(UltaTypeOf&& other) noexcept(__ULTNothrowMove_t::value) : m_ucIndex((unsigned char)g_ziEmpty)
+		{
+			other.Visit([this](auto& value) { Construct(std::move(value)); });
+		}
+
+		inline ~UltaTypeOf() { Reset(); }
+
+		inline UltaTypeOf& operator=(const UltaTypeOf& other)
+		{
+			if (this == &other) return *this;
+			if (m_ucIndex != other.m_ucIndex) Reset();
+			other.Visit([this](const auto& value) { Assign(value); });
+			return *this;
+		}
+
+		inline UltaTypeOf& operator=(UltaTypeOf&& other) noexcept(__ULTNothrowMoveAssign_t::value)
+		{
+			if (this == &other) return *this;
+			if (m_ucIndex != other.m_ucIndex) Reset();
+			other.Visit([this](auto& value) { Assign(std::move(value)); });
+			return *this;
+		}
+
+		template <typename T, typename = typename std::enable_if<__ULTIsStored_t<T>::value>::type>
+		inline UltaTypeOf& operator=(const T& value)
+		{
+			if (!Is<T>()) Reset();
+			Assign(value);
+			return *this;
+		}
+
+		template <typename T, __ULTIsUltaType_t<T> = 0>
+		inline UltaTypeOf& operator=(const T& value)
+		{
+			AssignFrom<0>(value);
+			return *this;
+		}
+
+		template <typename T, typename... Args>
+		inline T& Emplace(Args&&... args)
+		{
+			static_assert(__ULTIsStored_t<T>::value, "T isn't one of UltaTypeOf types");
+			Reset();
+			T* res = new (m_aStorage) T(std::forward<Args>(args)...);
+			m_ucIndex = (unsigned char)IndexOf_t<T>::value;
+			return *res;
+		}
+
+		inline void Reset() noexcept
+		{
+			Visit([](auto& value) { __ultDestroy(value); });
+			m_ucIndex = (unsigned char)g_ziEmpty;
+		}
+
+		inline size_t GetIndex() const noexcept { return m_ucIndex; }
+		inline bool IsEmpty() const noexcept { return m_ucIndex == g_ziEmpty; }
+
+		template <typename T>
+		inline bool Is() const noexcept
+		{
+			return m_ucIndex == IndexOf_t<T>::value;
+		}
+
+		// Calls fn with stored value (T& or const T&), does nothing and returns R() for empty UltaTypeOf
+		template <typename F>
+		inline decltype(auto) Visit(F&& fn)
+		{
+			using R = decltype(fn(std::declval<TypeAt_t<0>&>()));
+			return ULTVariant::__ULTVisit_t<0, Ts...>::template Visit<R>(m_ucIndex, m_aStorage, std::forward<F>(fn));
+		}
+
+		template <typename F>
+		inline decltype(auto) Visit(F&& fn) const
+		{
+			using R = decltype(fn(std::declval<const TypeAt_t<0>&>()));
+			return ULTVariant::__ULTVisit_t<0, Ts...>::template Visit<R>(m_ucIndex, m_aStorage, std::forward<F>(fn));
+		}
+
+		template <typename T>
+		inline T& GetValueHard() noexcept
+		{
+			return *reinterpret_cast<T*>(m_aStorage);
+		}
+
+		template <typename T>
+		inline const T& GetValueHard() const noexcept
+		{
+			return *reinterpret_cast<const T*>(m_aStorage);
+		}
+
+		// Converts stored value directly into out. Returns false and leaves out untouched
+		// if stored type can't be converted to T.
+		template <typename T>
+		inline bool TryGetAs(T& out) const
+		{
+			if (Is<T>())
+			{
+				out = GetValueHard<T>();
+				return true;
+			}
+			return Visit([&out](const auto& value) {
+				using S = typename std::decay<decltype(value)>::type;
+				return ULTVariant::__ultConvert(value, out, ULTVariant::__ULTConvertDispatch_t<S, T>());
+			});
+		}
+
+		// Unlike UltaType::GetValue returns copy, T() if stored type can't be converted
+		template <typename T>
+		inline T GetValue() const
+		{
+			T res = T();
+			TryGetAs(res);
+			return res;
+		}
+
+		inline UltaTypeView GetView() const noexcept
+		{
+			return Visit([](const auto& value) { return UltaTypeView::Of(value); });
+		}
+
+		// Same as UltaType::GetHash of equal value
+		inline size_t GetHash() const noexcept { return GetView().GetHash(); }
+
+		inline operator UltaType() const
+		{
+			return Visit([](const auto& value) { return UltaType(value); });
+		}
+
+		inline bool operator==(const UltaTypeOf& other) const { return Compare(other) == 0; }
+		inline bool operator!=(const UltaTypeOf& other) const { return !(*this == other); }
+		inline bool operator<(const UltaTypeOf& other) const { return Compare(other) == -1; }
+		inline bool operator>(const UltaTypeOf& other) const { return Compare(other) == 1; }
+
+		inline bool operator<=(const UltaTypeOf& other) const
+		{
+			const int res = Compare(other);
+			return res == -1 || res == 0;
+		}
+
+		inline bool operator>=(const UltaTypeOf& other) const
+		{
+			const int res = Compare(other);
+			return res == 1 || res == 0;
+		}
+
+		// Result keeps type of left operand, left operand is returned as is if there's no operator for the pair
+		inline UltaTypeOf operator+(const UltaTypeOf& other) const
+		{
+			return UltaTypeOf(*this).ApplyInPlace<ULTOperations::Operation_t::OPERATION_PLUS>(other);
+		}
+
+		inline UltaTypeOf operator-(const UltaTypeOf& other) const
+		{
+			return UltaTypeOf(*this).ApplyInPlace<ULTOperations::Operation_t::OPERATION_MINUS>(other);
+		}
+
+		inline UltaTypeOf operator*(const UltaTypeOf& other) const
+		{
+			return UltaTypeOf(*this).ApplyInPlace<ULTOperations::Operation_t::OPERATION_MULTIPLY>(other);
+		}
+
+		inline UltaTypeOf operator/(const UltaTypeOf& other) const
+		{
+			return UltaTypeOf(*this).ApplyInPlace<ULTOperations::Operation_t::OPERATION_DIVIDE>(other);
+		}
+
+		inline UltaTypeOf& operator+=(const UltaTypeOf& other)
+		{
+			return ApplyInPlace<ULTOperations::Operation_t::OPERATION_PLUS>(other);
+		}
+
+		inline UltaTypeOf& operator-=(const UltaTypeOf& other)
+		{
+			return ApplyInPlace<ULTOperations::Operation_t::OPERATION_MINUS>(other);
+		}
+
+		inline UltaTypeOf& operator*=(const UltaTypeOf& other)
+		{
+			return ApplyInPlace<ULTOperations::Operation_t::OPERATION_MULTIPLY>(other);
+		}
+
+		inline UltaTypeOf& operator/=(const UltaTypeOf& other)
+		{
+			return ApplyInPlace<ULTOperations::Operation_t::OPERATION_DIVIDE>(other);
+		}
+
+	private:
+		template <typename T>
+		static inline void __ultDestroy(T& value) noexcept
+		{
+			value.~T();
+		}
+
+		// Storage must be empty
+		template <typename T>
+		inline void Construct(T&& value)
+		{
+			using Value_t = typename std::decay<T>::type;
+			new (m_aStorage) Value_t(std::forward<T>(value));
+			m_ucIndex = (unsigned char)IndexOf_t<Value_t>::value;
+		}
+
+		// Storage must be empty or hold the same type
+		template <typename T>
+		inline void Assign(T&& value)
+		{
+			using Value_t = typename std::decay<T>::type;
+			if (Is<Value_t>())
+				GetValueHard<Value_t>() = std::forward<T>(value);
+			else
+				Construct(std::forward<T>(value));
+		}
+
+		template <size_t I>
+		inline typename std::enable_if<(I < sizeof...(Ts))>::type AssignFrom(const UltaType& value)
+		{
+			using T = TypeAt_t<I>;
+			if (!value.IsSameType<T>()) return AssignFrom<I + 1>(value);
+
+			if (!Is<T>()) Reset();
+			Assign(UltaTypeView(value).GetValueHard<T>());
+		}
+
+		template <size_t I>
+		inline typename std::enable_if<I == sizeof...(Ts)>::type AssignFrom(const UltaType&)
+		{
+			Reset();
+		}
+
+		inline int Compare(const UltaTypeOf& other) const
+		{
+			if (IsEmpty() || other.IsEmpty()) return 2;
+			return Visit([&other](const auto& a) {
+				return other.Visit([&a](const auto& b) {
+					using A = typename std::decay<decltype(a)>::type;
+					using B = typename std::decay<decltype(b)>::type;
+					return ULTVariant::__ultCompare(a, b, ULTVariant::__ULTCompareDispatch_t<A, B>());
+				});
+			});
+		}
+
+		template <ULTOperations::Operation_t Op>
+		inline UltaTypeOf& ApplyInPlace(const UltaTypeOf& other)
+		{
+			if (other.IsEmpty()) return *this;
+			Visit([&other](auto& a) {
+				other.Visit([&a](const auto& b) {
+					using A = typename std::decay<decltype(a)>::type;
+					using B = typename std::decay<decltype(b)>::type;
+					ULTVariant::__ultApply<Op>(a, b, ULTVariant::__ULTOperatorDispatch_t<A, B>());
+				});
+			});
+			return *this;
+		}
+
+	private:
+		alignas(Ts...) unsigned char m_aStorage[ULTVariant::__ULTMax_t<sizeof(Ts)...>::value];
+		unsigned char m_ucIndex;
+	};
+
+#if __cplusplus < 201703L
+	template <typename... Ts>
+	constexpr size_t UltaTypeOf<Ts...>::g_ziEmpty;
+#endif
+} // namespace ULT
+
+#endif
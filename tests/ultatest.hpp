@@ -0,0 +1,59 @@
+/*
+============================================
+- File: ultatest.hpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Checks used by regression
+  tests, every test is its own program.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#pragma once
+#ifndef ULTATEST_HPP
+#define ULTATEST_HPP
+
+#include <cstdio>
+
+namespace ULTTest
+{
+	inline int& GetFailures() noexcept
+	{
+		static int g_iFailures = 0;
+		return g_iFailures;
+	}
+
+	inline void Fail(const char* file, int line, const char* expression) noexcept
+	{
+		fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+		GetFailures()++;
+	}
+
+	// Exit code of test: 0 if every check passed
+	inline int Finish() noexcept
+	{
+		if (GetFailures()) fprintf(stderr, "%d check(s) failed\n", GetFailures());
+		return GetFailures() ? 1 : 0;
+	}
+} // namespace ULTTest
+
+#define ULTTEST_CHECK(condition) ((condition) ? (void)0 : ULTTest::Fail(__FILE__, __LINE__, #condition))
+
+// Checks that expression throws exception of given type
+#define ULTTEST_CHECK_THROWS(expression, exception)                                                                    \
+	do                                                                                                                 \
+	{                                                                                                                  \
+		bool __bThrown = false;                                                                                        \
+		try                                                                                                            \
+		{                                                                                                              \
+			expression;                                                                                                \
+		}                                                                                                              \
+		catch (const exception&)                                                                                       \
+		{                                                                                                              \
+			__bThrown = true;                                                                                          \
+		}                                                                                                              \
+		if (!__bThrown) ULTTest::Fail(__FILE__, __LINE__, #expression " throws " #exception);                          \
+	} while (0)
+
+#endif
@@ -0,0 +1,72 @@
+/*
+============================================
+- File: ultatest_atomic.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Hazard pointers of nested
+  AtomicUltaType operations.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultaatomic.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	// Boxed value that runs hook while it's copied
+	struct Probe_t
+	{
+		static int g_iLive;
+		static void (*g_pHook)();
+
+		Probe_t() { g_iLive++; }
+		Probe_t(const Probe_t&)
+		{
+			g_iLive++;
+			if (g_pHook) g_pHook();
+		}
+		Probe_t& operator=(const Probe_t&) = default;
+		~Probe_t() { g_iLive--; }
+	};
+
+	int Probe_t::g_iLive = 0;
+	void (*Probe_t::g_pHook)() = nullptr;
+
+	AtomicUltaType* g_pOuter = nullptr;
+	AtomicUltaType* g_pInner = nullptr;
+
+	// Runs inside Load of g_pOuter: nested Load, then replaces and retires the node being copied
+	void Hook()
+	{
+		Probe_t::g_pHook = nullptr;
+		ULTTEST_CHECK(g_pInner->Load().GetValue<std::string>() == std::string(40, 'i'));
+
+		const int live = Probe_t::g_iLive;
+		for (int i = 0; i < ULTATYPE_ATOMIC_RETIRE_THRESHOLD * 2; i++)
+			g_pOuter->Store(std::string(40, 'o'));
+		ULTTEST_CHECK(Probe_t::g_iLive == live); // Node being copied is still protected
+	}
+
+	void TestNestedLoad()
+	{
+		AtomicUltaType outer{Probe_t()};
+		AtomicUltaType inner{std::string(40, 'i')};
+		g_pOuter = &outer;
+		g_pInner = &inner;
+
+		Probe_t::g_pHook = Hook;
+		const UltaType copy = outer.Load();
+		ULTTEST_CHECK(copy.IsSameType<Probe_t>());
+	}
+} // namespace
+
+int main()
+{
+	TestNestedLoad();
+	return ULTTest::Finish();
+}
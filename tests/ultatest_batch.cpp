@@ -0,0 +1,65 @@
+/*
+============================================
+- File: ultatest_batch.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Batch arithmetic over columns
+  agrees with per element arithmetic.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultacolumn.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	UltaColumn MakeColumn(size_t size, int first)
+	{
+		UltaColumn column;
+		for (size_t i = 0; i < size; i++)
+			column.Push(first + (int)i);
+		return column;
+	}
+
+	// Result has min(a.Size(), b.Size()) values whichever path computes it
+	void TestDifferentSizes()
+	{
+		const UltaColumn a = MakeColumn(5, 1);
+		const UltaColumn b = MakeColumn(3, 10);
+
+		UltaColumn batch;
+		PlusN(a, b, batch);
+		ULTTEST_CHECK(!batch.IsMixed());
+		ULTTEST_CHECK(batch.Size() == 3);
+
+		UltaColumn mixedB = b;
+		mixedB.Push(std::string("x"));
+		mixedB.Truncate(3);
+		ULTTEST_CHECK(mixedB.IsMixed() && mixedB.Size() == 3);
+
+		UltaColumn single;
+		PlusN(a, mixedB, single);
+		ULTTEST_CHECK(single.Size() == 3);
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			ULTTEST_CHECK(batch[i].GetValue<int>() == 11 + 2 * (int)i);
+			ULTTEST_CHECK(single[i].GetValue<int>() == batch[i].GetValue<int>());
+		}
+
+		UltaColumn inPlace = a;
+		MultiplyN(inPlace, b, inPlace);
+		ULTTEST_CHECK(inPlace.Size() == 3 && inPlace[2].GetValue<int>() == 36);
+	}
+} // namespace
+
+int main()
+{
+	TestDifferentSizes();
+	return ULTTest::Finish();
+}
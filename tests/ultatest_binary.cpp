@@ -0,0 +1,63 @@
+/*
+============================================
+- File: ultatest_binary.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Varints of binary format and
+  rejection of malformed ones.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultabinary.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	bool Read(const unsigned char* data, size_t size, unsigned long long& value)
+	{
+		const unsigned char* src = data;
+		return ULTBinary::ReadVarint(src, data + size, value);
+	}
+
+	void TestRoundTrip()
+	{
+		const unsigned long long values[] = {0, 1, 127, 128, 300, 1ull << 62, 1ull << 63, ~0ull};
+		for (unsigned long long value : values)
+		{
+			unsigned char buffer[16];
+			const size_t length = ULTBinary::WriteVarint(value, buffer);
+			ULTTEST_CHECK(length == ULTBinary::GetVarintLength(value));
+
+			unsigned long long read = 0;
+			ULTTEST_CHECK(Read(buffer, length, read) && read == value);
+			ULTTEST_CHECK(!Read(buffer, length - 1, read));
+		}
+	}
+
+	// Tenth byte carries only bit 63
+	void TestOverflow()
+	{
+		unsigned char buffer[11] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00};
+		unsigned long long value = 0;
+		ULTTEST_CHECK(Read(buffer, 10, value) && value == ~0ull);
+
+		buffer[9] = 0x02;
+		ULTTEST_CHECK(!Read(buffer, 10, value));
+		buffer[9] = 0x7F;
+		ULTTEST_CHECK(!Read(buffer, 10, value));
+		buffer[9] = 0x81;
+		ULTTEST_CHECK(!Read(buffer, 11, value));
+	}
+} // namespace
+
+int main()
+{
+	TestRoundTrip();
+	TestOverflow();
+	return ULTTest::Finish();
+}
@@ -0,0 +1,76 @@
+/*
+============================================
+- File: ultatest_convert.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Conversions of TryGetAs and As
+  from malformed and out of range text.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultascalar.hpp"
+#include "ultatypeof.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	template <typename V>
+	void CheckParse(const V& good, const V& bad, const V& huge)
+	{
+		int i = 7;
+		ULTTEST_CHECK(good.template TryGetAs<int>(i) && i == 12);
+
+		double d = 3.5;
+		ULTTEST_CHECK(!bad.template TryGetAs<double>(d) && d == 3.5);
+		i = 7;
+		ULTTEST_CHECK(!huge.template TryGetAs<int>(i) && i == 7);
+		long long l = 0;
+		ULTTEST_CHECK(huge.template TryGetAs<long long>(l) && l == 99999999999LL);
+	}
+
+	void TestUltaType()
+	{
+		CheckParse(UltaType(std::string("12")), UltaType(std::string("x")), UltaType(std::string("99999999999")));
+
+		const UltaType bad(std::string("x"));
+		ULTTEST_CHECK(bad.GetValue<double>() == 0.0);
+#if __cplusplus >= 201703L
+		ULTTEST_CHECK(!bad.As<double>());
+		ULTTEST_CHECK(!UltaType(std::string("99999999999")).As<int>());
+		ULTTEST_CHECK(UltaType(std::string("12")).As<int>() == 12);
+#endif
+	}
+
+	void TestUltaTypeView()
+	{
+		const UltaType good(std::string("12")), bad(std::string("x")), huge(std::string("99999999999"));
+		CheckParse(UltaTypeView(good), UltaTypeView(bad), UltaTypeView(huge));
+		ULTTEST_CHECK(UltaTypeView(bad).GetValue<double>() == 0.0);
+	}
+
+	void TestUltaScalar()
+	{
+		CheckParse(UltaScalar(std::string("12")), UltaScalar(std::string("x")),
+				   UltaScalar(std::string("99999999999")));
+	}
+
+	void TestUltaTypeOf()
+	{
+		using Value_t = UltaTypeOf<int, std::string>;
+		CheckParse(Value_t(std::string("12")), Value_t(std::string("x")), Value_t(std::string("99999999999")));
+	}
+} // namespace
+
+int main()
+{
+	TestUltaType();
+	TestUltaTypeView();
+	TestUltaScalar();
+	TestUltaTypeOf();
+	return ULTTest::Finish();
+}
@@ -0,0 +1,87 @@
+/*
+============================================
+- File: ultatest_csv.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Empty and quoted fields of
+  UltaCsvReader and UltaCsvColumns.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultacsv.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	UltaCsvColumns Read(const std::string& text)
+	{
+		UltaCsvReader reader;
+		UltaCsvColumns columns;
+		reader.Feed(text.data(), text.size(), columns);
+		reader.Finish(columns);
+		return columns;
+	}
+
+	// "" is a string, empty unquoted field is missing value
+	void TestQuotedEmpty()
+	{
+		std::vector<bool> strings;
+		UltaCsvReader reader;
+		const std::string text = "\"\",,\"\"\n";
+		reader.Feed(text.data(), text.size(), [&strings](const ULTCsv::Field_t& field) {
+			strings.push_back(field.value.IsSameType<std::string>() && field.value.GetValue<std::string>().empty());
+		});
+		ULTTEST_CHECK(strings == std::vector<bool>({true, false, true}));
+	}
+
+	// Empty fields don't make column mixed, they are marked in IsEmpty
+	void TestEmptyKeepsType()
+	{
+		const UltaCsvColumns columns = Read("1,a,\n,,2.5\n3,\"\",\n");
+		ULTTEST_CHECK(columns.GetColumns().size() == 3);
+
+		const UltaColumn& ints = columns.GetColumns()[0];
+		ULTTEST_CHECK(!ints.IsMixed() && ints.GetTypeIndex() == ULTReflection::BaseTypes_t::TYPE_INT);
+		ULTTEST_CHECK(ints.Size() == 3 && ints[0].GetValue<int>() == 1 && ints[2].GetValue<int>() == 3);
+		ULTTEST_CHECK(!columns.IsEmpty(0, 0) && columns.IsEmpty(0, 1) && !columns.IsEmpty(0, 2));
+
+		const UltaColumn& strings = columns.GetColumns()[1];
+		ULTTEST_CHECK(!strings.IsMixed() && strings.GetTypeIndex() == ULTReflection::BaseTypes_t::TYPE_STDSTRING);
+		ULTTEST_CHECK(columns.IsEmpty(1, 1) && !columns.IsEmpty(1, 2));
+		ULTTEST_CHECK(strings[2].GetValue<std::string>().empty());
+
+		// Empty before the first value
+		const UltaColumn& reals = columns.GetColumns()[2];
+		ULTTEST_CHECK(!reals.IsMixed() && reals.GetTypeIndex() == ULTReflection::BaseTypes_t::TYPE_DOUBLE);
+		ULTTEST_CHECK(reals.Size() == 3 && reals[1].GetValue<double>() == 2.5);
+		ULTTEST_CHECK(columns.IsEmpty(2, 0) && !columns.IsEmpty(2, 1) && columns.IsEmpty(2, 2));
+	}
+
+	// Empty fields become empty strings, not "0", when column turns into strings
+	void TestWidenToStrings()
+	{
+		const UltaCsvColumns gaps = Read("1,\n,\n7,\nx,\n");
+		const UltaColumn& widened = gaps.GetColumns()[0];
+		ULTTEST_CHECK(!widened.IsMixed() && widened.Size() == 4);
+		ULTTEST_CHECK(widened[0].GetValue<std::string>() == "1");
+		ULTTEST_CHECK(widened[1].GetValue<std::string>().empty() && gaps.IsEmpty(0, 1));
+		ULTTEST_CHECK(widened[3].GetValue<std::string>() == "x");
+
+		// Column of nothing but empty fields
+		const UltaColumn& empty = gaps.GetColumns()[1];
+		ULTTEST_CHECK(empty.Size() == 4 && !empty[0].GetTypeOps() && gaps.IsEmpty(1, 3));
+	}
+} // namespace
+
+int main()
+{
+	TestQuotedEmpty();
+	TestEmptyKeepsType();
+	TestWidenToStrings();
+	return ULTTest::Finish();
+}
@@ -0,0 +1,86 @@
+/*
+============================================
+- File: ultatest_lifecycle.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Storing, copying and moving
+  values of UltaType.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultaatomic.hpp"
+#include "ultacolumn.hpp"
+#include "ultaobject.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	// String literals are char arrays, they are kept as std::string
+	void TestStringLiteral()
+	{
+		UltaType a("abc");
+		ULTTEST_CHECK(a.IsSameType<std::string>());
+		ULTTEST_CHECK(a.GetValue<std::string>() == "abc");
+
+		a.SetValue("de");
+		ULTTEST_CHECK(a.GetValue<std::string>() == "de");
+		a.SetValue(5);
+		a = "fgh";
+		ULTTEST_CHECK(a.IsSameType<std::string>());
+		ULTTEST_CHECK(a.GetValue<std::string>() == "fgh");
+
+		const char text[6] = {'a', 'b', '\0', 'c', 'd', 'e'};
+		ULTTEST_CHECK(UltaType(text).GetValue<std::string>() == "ab");
+
+		UltaObject object;
+		object.Set("name", "Alice");
+		ULTTEST_CHECK(object.Find("name")->GetValue<std::string>() == "Alice");
+		object.Set("name", "Bob");
+		ULTTEST_CHECK(object.Find("name")->GetValue<std::string>() == "Bob");
+
+		UltaColumn column;
+		column.Push("x");
+		ULTTEST_CHECK(column.Size() == 1 && column[0].GetValueHard<std::string>() == "x");
+
+		AtomicUltaType atomic("y");
+		ULTTEST_CHECK(atomic.Load().GetValue<std::string>() == "y");
+		atomic.Store("z");
+		ULTTEST_CHECK(atomic.Load().GetValue<std::string>() == "z");
+	}
+
+	struct FailingResource_t final : ULTMemory::MemoryResource_t
+	{
+		void* Allocate(size_t, size_t) override { throw std::bad_alloc(); }
+		void Deallocate(void*, size_t, size_t) noexcept override {}
+	};
+
+	static_assert(std::is_nothrow_move_constructible<UltaType>::value, "");
+	static_assert(!std::is_nothrow_move_assignable<UltaType>::value, "");
+
+	// Moving between resources allocates, failure is thrown out and leaves source as it was
+	void TestMoveAcrossResources()
+	{
+		const std::string text(64, 'x');
+		FailingResource_t resource;
+		UltaType target(&resource);
+		UltaType source(text);
+		ULTTEST_CHECK_THROWS(target = std::move(source), std::bad_alloc);
+		ULTTEST_CHECK(!target.GetTypeHash() && source.GetValue<std::string>() == text);
+
+		UltaType heap;
+		heap = std::move(source);
+		ULTTEST_CHECK(heap.GetValue<std::string>() == text);
+	}
+} // namespace
+
+int main()
+{
+	TestStringLiteral();
+	TestMoveAcrossResources();
+	return ULTTest::Finish();
+}
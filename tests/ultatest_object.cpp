@@ -0,0 +1,76 @@
+/*
+============================================
+- File: ultatest_object.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Fields of UltaObject keep the
+  order they were added in.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultaobject.hpp"
+
+#include <vector>
+
+using namespace ULT;
+
+namespace
+{
+	std::vector<std::string> GetNames(const UltaObject& object)
+	{
+		std::vector<std::string> names;
+		object.ForEach([&names](const std::string& name, const UltaType&) { names.push_back(name); });
+		return names;
+	}
+
+	void TestRemoveOrder()
+	{
+		UltaObject object;
+		object.Set("a", 1);
+		object.Set("b", 2);
+		object.Set("c", 3);
+
+		ULTTEST_CHECK(object.Remove("a"));
+		ULTTEST_CHECK(object.IsDictionary());
+		ULTTEST_CHECK(GetNames(object) == std::vector<std::string>({"b", "c"}));
+
+		object.Set("d", 4);
+		object.Set("a", 5);
+		ULTTEST_CHECK(object.Remove("c"));
+		ULTTEST_CHECK(!object.Remove("c"));
+		ULTTEST_CHECK(GetNames(object) == std::vector<std::string>({"b", "d", "a"}));
+		ULTTEST_CHECK(object.Find("b")->GetValue<int>() == 2);
+		ULTTEST_CHECK(object.Find("d")->GetValue<int>() == 4);
+		ULTTEST_CHECK(object.Find("a")->GetValue<int>() == 5);
+	}
+
+	// Lookups still find every key after many removals shift entries
+	void TestEraseOrdered()
+	{
+		UltaHashMap<int> map;
+		for (int i = 0; i < 100; i++)
+			map[i] = i;
+		for (int i = 0; i < 100; i += 3)
+			ULTTEST_CHECK(map.EraseOrdered(i));
+
+		int previous = -1;
+		for (const UltaHashMap<int>::Entry_t& entry : map)
+		{
+			ULTTEST_CHECK(entry.second > previous && entry.second % 3 != 0);
+			previous = entry.second;
+		}
+		for (int i = 0; i < 100; i++)
+			ULTTEST_CHECK((map.Find(i) != nullptr) == (i % 3 != 0) && (!map.Find(i) || *map.Find(i) == i));
+	}
+} // namespace
+
+int main()
+{
+	TestRemoveOrder();
+	TestEraseOrdered();
+	return ULTTest::Finish();
+}
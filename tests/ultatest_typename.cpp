@@ -0,0 +1,46 @@
+/*
+============================================
+- File: ultatest_typename.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Type names of values with
+  ULTATYPE_SAVE_TYPENAME.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#define ULTATYPE_SAVE_TYPENAME
+#include "ultatest.hpp"
+
+#include "ultatype.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	// Names compare by value, not by address
+	void TestCompare()
+	{
+		const UltaType i(5);
+		ULTTEST_CHECK(i.GetTypeName() == "int");
+		ULTTEST_CHECK(i.GetTypeName() == std::string("int"));
+		ULTTEST_CHECK(UltaType(2.0).GetTypeName() == "double");
+		ULTTEST_CHECK(UltaType().GetTypeName() == "");
+	}
+
+	// Every value of a type gives the same interned name
+	void TestInterned()
+	{
+		const UltaType a(5), b(7);
+		ULTTEST_CHECK(&a.GetTypeName()[0] == &b.GetTypeName()[0]);
+		ULTTEST_CHECK(&a.GetTypeName()[0] == &ULTReflection::GetTypeName(typeid(int))[0]);
+	}
+} // namespace
+
+int main()
+{
+	TestCompare();
+	TestInterned();
+	return ULTTest::Finish();
+}
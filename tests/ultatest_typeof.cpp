@@ -0,0 +1,65 @@
+/*
+============================================
+- File: ultatest_typeof.cpp
+- Author: Vadim "VAX325"
+- Creation date: 17.10.2026 / 10:00
+- Last edit date: 17.10.2026 / 10:00
+- Description: Moves of UltaTypeOf and its
+  conversions from UltaType.
+- MIT Licensed. (See LICENSE for more info)
+=============================================
+*/
+
+#include "ultatest.hpp"
+
+#include "ultatypeof.hpp"
+
+using namespace ULT;
+
+namespace
+{
+	struct ThrowingMove_t
+	{
+		ThrowingMove_t() = default;
+		ThrowingMove_t(const ThrowingMove_t&) = default;
+		ThrowingMove_t(ThrowingMove_t&&) noexcept(false) {}
+		ThrowingMove_t& operator=(const ThrowingMove_t&) = default;
+		ThrowingMove_t& operator=(ThrowingMove_t&&) noexcept(false) { return *this; }
+	};
+
+	using Number_t = UltaTypeOf<int, double>;
+
+	// Moves are noexcept only if moves of every type are
+	static_assert(std::is_nothrow_move_constructible<Number_t>::value, "");
+	static_assert(std::is_nothrow_move_assignable<Number_t>::value, "");
+	static_assert(!std::is_nothrow_move_constructible<UltaTypeOf<int, ThrowingMove_t>>::value, "");
+	static_assert(!std::is_nothrow_move_assignable<UltaTypeOf<int, ThrowingMove_t>>::value, "");
+
+	// Types outside of Ts don't sneak in through UltaType
+	static_assert(!std::is_assignable<Number_t&, long>::value, "");
+	static_assert(!std::is_constructible<Number_t, long>::value, "");
+	static_assert(!std::is_convertible<UltaType, Number_t>::value, "");
+	static_assert(std::is_constructible<Number_t, UltaType>::value, "");
+	static_assert(std::is_assignable<Number_t&, UltaType>::value, "");
+
+	void TestFromUltaType()
+	{
+		Number_t value(UltaType(5));
+		ULTTEST_CHECK(value.Is<int>() && value.GetValueHard<int>() == 5);
+
+		value = UltaType(2.5);
+		ULTTEST_CHECK(value.Is<double>() && value.GetValueHard<double>() == 2.5);
+
+		value = UltaType(5L);
+		ULTTEST_CHECK(value.IsEmpty());
+
+		value = 7;
+		ULTTEST_CHECK(value.Is<int>() && UltaType(value).GetValue<int>() == 7);
+	}
+} // namespace
+
+int main()
+{
+	TestFromUltaType();
+	return ULTTest::Finish();
+}